@@ -117,22 +117,109 @@ static void BuildTurnOrder(BattleContext *ctx)
     }
 }
 
-// True if no living combatant stands on (x, y). The actor's own tile is
-// always allowed (they move into the neighbour, then "vacate" conceptually).
-static bool CombatantOnTile(const BattleContext *ctx, const Combatant *ignore,
-                            int x, int y)
+// ---------- Occupancy ----------
+//
+// ctx->occupant mirrors where the living combatants stand so tile queries are
+// one array read instead of a walk over both rosters. Cells hold 1 + a body
+// index (party members 0..PARTY_MAX-1, then enemies), 0 when empty. If two
+// combatants ever share a tile (battle placement falls back to Jan's tile when
+// the map is cramped) the cell keeps the lowest body, which is the one the
+// old roster scan found first; ctx->occupantCount says how many share it, so
+// the rosters are only walked for a shared tile. Kept current by
+// CombatantSetTile, CombatantFaint and OccupancyRebuild; nothing else in
+// battle.c writes tileX/tileY or alive.
+
+static int BodyOf(const BattleContext *ctx, const Combatant *c)
+{
+    if (c >= ctx->party->members && c < ctx->party->members + PARTY_MAX)
+        return (int)(c - ctx->party->members);
+    return PARTY_MAX + (int)(c - ctx->enemies);
+}
+
+static Combatant *BodyCombatant(BattleContext *ctx, int body)
+{
+    return body < PARTY_MAX ? &ctx->party->members[body]
+                            : &ctx->enemies[body - PARTY_MAX];
+}
+
+static int OccupancyCell(const BattleContext *ctx, int x, int y)
+{
+    const TileMap *m = ctx->map;
+    if (!m || x < 0 || y < 0 || x >= m->width || y >= m->height) return -1;
+    return y * m->width + x;
+}
+
+static void OccupancyPlace(BattleContext *ctx, const Combatant *c)
+{
+    int cell = OccupancyCell(ctx, c->tileX, c->tileY);
+    if (cell < 0 || !c->alive) return;
+    int body = BodyOf(ctx, c);
+    ctx->occupantCount[cell]++;
+    if (ctx->occupant[cell] == 0 || body < ctx->occupant[cell] - 1)
+        ctx->occupant[cell] = (unsigned char)(body + 1);
+}
+
+// Lowest living body other than `skip` standing on (x, y), or -1. Only called
+// for a tile occupantCount says is shared.
+static int BodyOnTileExcept(const BattleContext *ctx, int skip, int x, int y)
 {
     for (int i = 0; i < ctx->party->count; i++) {
         const Combatant *c = &ctx->party->members[i];
-        if (c == ignore || !c->alive) continue;
-        if (c->tileX == x && c->tileY == y) return true;
+        if (i != skip && c->alive && c->tileX == x && c->tileY == y) return i;
     }
     for (int i = 0; i < ctx->enemyCount; i++) {
         const Combatant *c = &ctx->enemies[i];
-        if (c == ignore || !c->alive) continue;
-        if (c->tileX == x && c->tileY == y) return true;
+        if (PARTY_MAX + i != skip && c->alive && c->tileX == x && c->tileY == y)
+            return PARTY_MAX + i;
     }
-    return false;
+    return -1;
+}
+
+static void OccupancyVacate(BattleContext *ctx, const Combatant *c)
+{
+    int cell = OccupancyCell(ctx, c->tileX, c->tileY);
+    if (cell < 0 || !c->alive) return;
+    ctx->occupantCount[cell]--;
+    if (ctx->occupant[cell] != BodyOf(ctx, c) + 1) return;
+    int other = ctx->occupantCount[cell] > 0
+              ? BodyOnTileExcept(ctx, BodyOf(ctx, c), c->tileX, c->tileY) : -1;
+    ctx->occupant[cell] = (unsigned char)(other + 1);
+}
+
+static void OccupancyRebuild(BattleContext *ctx)
+{
+    memset(ctx->occupant, 0, sizeof(ctx->occupant));
+    memset(ctx->occupantCount, 0, sizeof(ctx->occupantCount));
+    for (int i = 0; i < ctx->party->count; i++) OccupancyPlace(ctx, &ctx->party->members[i]);
+    for (int i = 0; i < ctx->enemyCount; i++)   OccupancyPlace(ctx, &ctx->enemies[i]);
+}
+
+static void CombatantSetTile(BattleContext *ctx, Combatant *c, int x, int y)
+{
+    OccupancyVacate(ctx, c);
+    c->tileX = x;
+    c->tileY = y;
+    OccupancyPlace(ctx, c);
+}
+
+static void CombatantFaint(BattleContext *ctx, Combatant *c)
+{
+    OccupancyVacate(ctx, c);
+    c->hp    = 0;
+    c->alive = false;
+}
+
+// True if a living combatant other than `ignore` stands on (x, y). The
+// actor's own tile is always allowed (they move into the neighbour, then
+// "vacate" conceptually).
+static bool CombatantOnTile(const BattleContext *ctx, const Combatant *ignore,
+                            int x, int y)
+{
+    int cell = OccupancyCell(ctx, x, y);
+    if (cell < 0 || ctx->occupant[cell] == 0) return false;
+    int body = ctx->occupant[cell] - 1;
+    if (!ignore || body != BodyOf(ctx, ignore)) return true;
+    return ctx->occupantCount[cell] > 1;
 }
 
 // Walkable-for-combat predicate: non-solid, non-warp, no combatant on it.
@@ -185,104 +272,25 @@ static int ChoosePartyTarget(const BattleContext *ctx, const Combatant *enemy)
     return best;
 }
 
-// BFS scratch clamp: we never flood more than this many tiles in each
-// direction from the actor. Dungeons are finite and small; a 24-tile
-// radius covers every playable floor with room to spare and keeps the
-// queue bounded to a few hundred cells.
-#define AI_BFS_RADIUS 24
-#define AI_BFS_DIAM   (AI_BFS_RADIUS * 2 + 1)
-
 // Returns the first-step tile toward `goal`, or the actor's own tile if no
-// path exists within the clamp. `goal` is treated as walkable even when
-// occupied (so the path can end adjacent to the target); every other tile
-// uses CombatTileWalkable for passability.
-//
-// BFS over a (2*radius+1)^2 window centred on the actor. Parent-pointer
-// reconstruction walks backwards from goal to actor and returns the tile
-// one step off actor's current cell.
-static TilePos BFSNextStep(const TileMap *m, const BattleContext *ctx,
-                           const Combatant *actor, TilePos goal)
+// path exists within the window. Served from the context's shared distance
+// fields (battle_path.h), so consecutive steps and enemies chasing the same
+// party member on an unchanged board don't re-flood.
+TilePos BFSNextStep(const TileMap *m, BattleContext *ctx,
+                    const Combatant *actor, TilePos goal)
 {
-    TilePos fallback = { actor->tileX, actor->tileY };
-    if (actor->tileX == goal.x && actor->tileY == goal.y) return fallback;
-
-    int originX = actor->tileX - AI_BFS_RADIUS;
-    int originY = actor->tileY - AI_BFS_RADIUS;
-
-    static int  parent[AI_BFS_DIAM * AI_BFS_DIAM];
-    static bool visited[AI_BFS_DIAM * AI_BFS_DIAM];
-    for (int i = 0; i < AI_BFS_DIAM * AI_BFS_DIAM; i++) { parent[i] = -1; visited[i] = false; }
-
-    // Ring queue sized to the window — worst case the whole window is
-    // reachable so that's the upper bound.
-    static int queue[AI_BFS_DIAM * AI_BFS_DIAM];
-    int qHead = 0, qTail = 0;
-
-    int startLocalX = actor->tileX - originX;
-    int startLocalY = actor->tileY - originY;
-    int startIdx = startLocalY * AI_BFS_DIAM + startLocalX;
-    visited[startIdx] = true;
-    queue[qTail++] = startIdx;
-
-    int goalIdx = -1;
-    int goalLocalX = goal.x - originX;
-    int goalLocalY = goal.y - originY;
-    bool goalInWindow = (goalLocalX >= 0 && goalLocalX < AI_BFS_DIAM &&
-                         goalLocalY >= 0 && goalLocalY < AI_BFS_DIAM);
-
-    static const int ndx[4] = { 1, -1, 0, 0 };
-    static const int ndy[4] = { 0, 0, 1, -1 };
-
-    while (qHead < qTail && goalIdx < 0) {
-        int cur = queue[qHead++];
-        int cx  = cur % AI_BFS_DIAM;
-        int cy  = cur / AI_BFS_DIAM;
-        int worldX = originX + cx;
-        int worldY = originY + cy;
-        if (worldX == goal.x && worldY == goal.y) { goalIdx = cur; break; }
-
-        for (int d = 0; d < 4; d++) {
-            int nlx = cx + ndx[d];
-            int nly = cy + ndy[d];
-            if (nlx < 0 || nly < 0 || nlx >= AI_BFS_DIAM || nly >= AI_BFS_DIAM) continue;
-            int nIdx = nly * AI_BFS_DIAM + nlx;
-            if (visited[nIdx]) continue;
-            int nwx = originX + nlx;
-            int nwy = originY + nly;
-            bool isGoal = (nwx == goal.x && nwy == goal.y);
-            // Goal cell is treated as passable even if a combatant stands there;
-            // every other cell must clear the normal combat-walkable predicate.
-            if (!isGoal && !CombatTileWalkable(m, ctx, actor, nwx, nwy)) continue;
-            visited[nIdx] = true;
-            parent[nIdx]  = cur;
-            queue[qTail++] = nIdx;
-            if (isGoal) { goalIdx = nIdx; break; }
-        }
-    }
-
-    if (goalIdx < 0 || !goalInWindow) return fallback;
-
-    // Walk back from goal to the cell whose parent is the start — that's the
-    // first step. If the goal is the start's neighbour, this loop runs once.
-    int cur = goalIdx;
-    while (parent[cur] != startIdx && parent[cur] != -1) cur = parent[cur];
-    if (parent[cur] == -1) return fallback; // unreachable
-
-    int firstLocalX = cur % AI_BFS_DIAM;
-    int firstLocalY = cur / AI_BFS_DIAM;
-    TilePos next = { originX + firstLocalX, originY + firstLocalY };
-    return next;
+    return BattlePathsNextStep(&ctx->paths, m, ctx, actor, goal);
 }
 
-// Step the enemy one tile toward `target` using BFS so walls/alcoves don't
-// trap the AI. Falls back to no-op when no path exists within the clamp.
+// Step the enemy one tile toward `target` along a shortest path so walls /
+// alcoves don't trap the AI. With no path on the grid (target walled off, or
+// more than BATTLE_PATH_RADIUS tiles away) the enemy doesn't move.
 static void AIStepToward(BattleContext *ctx, const TileMap *m, Combatant *actor,
                          TilePos target)
 {
     TilePos next = BFSNextStep(m, ctx, actor, target);
     if (next.x == actor->tileX && next.y == actor->tileY) return;
-    actor->tileX = next.x;
-    actor->tileY = next.y;
+    CombatantSetTile(ctx, actor, next.x, next.y);
 }
 
 // Pick the highest-power reachable move for `actor` against the currently
@@ -462,25 +470,12 @@ static void ConsumeMoveUse(BattleContext *ctx, bool actorIsEnemy, int slot)
 static Combatant *OccupantAtTile(BattleContext *ctx, TilePos tp,
                                  bool *outIsEnemy, int *outIdx)
 {
-    for (int i = 0; i < ctx->party->count; i++) {
-        Combatant *c = &ctx->party->members[i];
-        if (!c->alive) continue;
-        if (c->tileX == tp.x && c->tileY == tp.y) {
-            if (outIsEnemy) *outIsEnemy = false;
-            if (outIdx)     *outIdx     = i;
-            return c;
-        }
-    }
-    for (int i = 0; i < ctx->enemyCount; i++) {
-        Combatant *c = &ctx->enemies[i];
-        if (!c->alive) continue;
-        if (c->tileX == tp.x && c->tileY == tp.y) {
-            if (outIsEnemy) *outIsEnemy = true;
-            if (outIdx)     *outIdx     = i;
-            return c;
-        }
-    }
-    return NULL;
+    int cell = OccupancyCell(ctx, tp.x, tp.y);
+    if (cell < 0 || ctx->occupant[cell] == 0) return NULL;
+    int body = ctx->occupant[cell] - 1;
+    if (outIsEnemy) *outIsEnemy = body >= PARTY_MAX;
+    if (outIdx)     *outIdx     = body >= PARTY_MAX ? body - PARTY_MAX : body;
+    return BodyCombatant(ctx, body);
 }
 
 // Pick the overlay kind + accent color for a move. Accent is per-weapon for
@@ -556,8 +551,7 @@ static void ExecuteDash(BattleContext *ctx, const TileMap *m,
         int nx = actor->tileX + stepX;
         int ny = actor->tileY + stepY;
         if (!CombatTileWalkable(m, ctx, actor, nx, ny)) break;
-        actor->tileX = nx;
-        actor->tileY = ny;
+        CombatantSetTile(ctx, actor, nx, ny);
     }
 }
 
@@ -592,6 +586,7 @@ static int BattleSummonEnemy(BattleContext *ctx, const TileMap *m,
     CombatantInit(e, creatureId, level);
     e->tileX = sx;
     e->tileY = sy;
+    OccupancyPlace(ctx, e);
     ctx->enemyFieldIdx[idx] = -1;  // not tied to a FieldEnemy index — pure summon
     return idx;
 }
@@ -727,8 +722,7 @@ static void ApplyMoveToTile(BattleContext *ctx, const TileMap *m)
     if (enraged) ApplyEnragePhase2(ctx, m, target);
 
     if (target->hp <= 0) {
-        target->hp    = 0;
-        target->alive = false;
+        CombatantFaint(ctx, target);
         // Play the attacker's swing / projectile / ring, then chain the faint
         // slide so the killing blow gets the same visual as a non-lethal hit
         // (previously the faint cut the attack overlay entirely).
@@ -825,7 +819,7 @@ static void ExecuteAction(BattleContext *ctx, const TileMap *m)
                     enragedTarget = t;
                     ApplyEnragePhase2(ctx, m, t);
                 }
-                if (t->hp <= 0) { t->hp = 0; t->alive = false; }
+                if (t->hp <= 0) CombatantFaint(ctx, t);
             }
         } else {
             for (int i = 0; i < ctx->party->count; i++) {
@@ -847,7 +841,7 @@ static void ExecuteAction(BattleContext *ctx, const TileMap *m)
                     enragedTarget = t;
                     ApplyEnragePhase2(ctx, m, t);
                 }
-                if (t->hp <= 0) { t->hp = 0; t->alive = false; }
+                if (t->hp <= 0) CombatantFaint(ctx, t);
             }
         }
         if (hits > 0) {
@@ -945,6 +939,8 @@ void BattleBegin(BattleContext *ctx, Party *party, const TileMap *map,
     ctx->menu             = (BattleMenuState){0};
     ctx->anim             = (BattleAnim){0};
     for (int i = 0; i < PARTY_MAX; i++) ctx->partyMoveCursor[i] = 0;
+    OccupancyRebuild(ctx);
+    BattlePathsReset(&ctx->paths);
 
     BuildTurnOrder(ctx);
 
@@ -976,8 +972,7 @@ void BattleBegin(BattleContext *ctx, Party *party, const TileMap *map,
             PlayAttackAnimFor(ctx, mv, jan, false, 0,
                               target, true, targetIdx);
             if (target->hp <= 0) {
-                target->hp    = 0;
-                target->alive = false;
+                CombatantFaint(ctx, target);
                 BattleAnimQueueFaint(&ctx->anim, true, targetIdx);
                 snprintf(ctx->narration, NARRATION_LEN,
                          "Surprise %s! %s's %s dealt %d and took down %s!",
@@ -1137,8 +1132,7 @@ void BattleUpdate(BattleContext *ctx, const TileMap *map,
                 if (CombatTileWalkable(map, ctx, actor, nx, ny)) {
                     int prevX = actor->tileX;
                     int prevY = actor->tileY;
-                    actor->tileX = nx;
-                    actor->tileY = ny;
+                    CombatantSetTile(ctx, actor, nx, ny);
                     CombatantStartMoveAnim(actor, prevX, prevY,
                                            TILE_SIZE * TILE_SCALE,
                                            BATTLE_MOVE_ANIM_DUR);
@@ -7,6 +7,8 @@
 #include "battle_grid.h"
 #include "battle_menu.h"
 #include "battle_anim.h"
+#include "battle_path.h"
+#include "../field/tilemap.h"
 
 //----------------------------------------------------------------------------------
 // Battle - turn-based combat running inline on the dungeon tilemap. No separate
@@ -115,6 +117,17 @@ typedef struct BattleContext {
     int     enemyStepsRemaining;
     TilePos enemyMoveGoal;
 
+    // Living combatants by tile, [y * map->width + x]: 1 + body index (party
+    // members, then enemies), 0 = empty. Maintained in battle.c on every
+    // step, faint and summon; rebuilt by BattleBegin. occupantCount is how
+    // many living bodies share each tile.
+    unsigned char occupant[MAP_MAX_W * MAP_MAX_H];
+    unsigned char occupantCount[MAP_MAX_W * MAP_MAX_H];
+
+    // Enemy pathing distance fields, shared across steps and across enemies
+    // chasing the same party member. Reset by BattleBegin.
+    BattlePaths paths;
+
     // Mirrored from GameState->difficulty when the battle starts. 0 = easy
     // (enemy attacks deal half damage), 1 = hard (full).
     int     difficulty;
@@ -159,6 +172,13 @@ void BattleUpdate(BattleContext *ctx, const struct TileMap *map,
 void BattleDrawWorldOverlay(const BattleContext *ctx);
 void BattleDrawUI(const BattleContext *ctx);
 
+// Enemy AI pathing: first step of a shortest 4-connected path from actor
+// toward goal, or the actor's own tile if none is found within a 24-tile
+// window. Reads (and may rebuild) ctx->paths. Exposed for ddkp_bench; battle
+// code is the only game caller.
+TilePos BFSNextStep(const struct TileMap *m, BattleContext *ctx,
+                    const Combatant *actor, TilePos goal);
+
 // 0 = ongoing, 1 = victory, 2 = defeat, 3 = fled. Consume the result on a
 // Z press when narration is showing the final state.
 int  BattleFinished(const BattleContext *ctx);
@@ -1,5 +1,6 @@
 #include "battle_grid.h"
 #include "../field/tilemap.h"
+#include "../field/tile_los.h"
 #include "../data/move_defs.h"
 #include <stdlib.h>
 
@@ -10,33 +11,44 @@ int TileChebyshev(TilePos a, TilePos b)
     return dx > dy ? dx : dy;
 }
 
-bool TileHasLOS(const TileMap *m, TilePos a, TilePos b)
+#define RANGED_REACH 3
+
+static bool BresenhamLOS(const TileMap *m, int ax, int ay, int bx, int by)
 {
     // Standard Bresenham — one step per iteration. Neither endpoint is tested
     // for blocking, so the attacker's own tile and the target's tile are
     // always transparent. Water tiles do not block LOS (only solids do).
-    int x = a.x, y = a.y;
-    int dx = abs(b.x - a.x);
-    int dy = abs(b.y - a.y);
-    int sx = a.x < b.x ? 1 : -1;
-    int sy = a.y < b.y ? 1 : -1;
+    int x = ax, y = ay;
+    int dx = abs(bx - ax);
+    int dy = abs(by - ay);
+    int sx = ax < bx ? 1 : -1;
+    int sy = ay < by ? 1 : -1;
     int err = dx - dy;
     while (true) {
-        if (x == b.x && y == b.y) return true;
+        if (x == bx && y == by) return true;
         int e2 = 2 * err;
         if (e2 > -dy) { err -= dy; x += sx; }
         if (e2 <  dx) { err += dx; y += sy; }
-        if (x == b.x && y == b.y) return true;
+        if (x == bx && y == by) return true;
         if (TileMapIsSolid(m, x, y)) return false;
     }
 }
 
+// Everything within ranged reach is answered from per-tile bits; the AI move
+// scan and the target cursor ask these same pairs every frame.
+static TileLosCache gRangedLos = TILE_LOS_CACHE(RANGED_REACH, BresenhamLOS);
+
+bool TileHasLOS(const TileMap *m, TilePos a, TilePos b)
+{
+    return TileLosCacheTest(&gRangedLos, m, a.x, a.y, b.x, b.y);
+}
+
 bool TileMoveReaches(const TileMap *m, TilePos attacker, TilePos target,
                      int moveRange)
 {
     if (moveRange == RANGE_AOE || moveRange == RANGE_SELF) return true;
     int d = TileChebyshev(attacker, target);
     if (moveRange == RANGE_MELEE)  return d <= 1;
-    if (moveRange == RANGE_RANGED) return d <= 3 && TileHasLOS(m, attacker, target);
+    if (moveRange == RANGE_RANGED) return d <= RANGED_REACH && TileHasLOS(m, attacker, target);
     return false;
 }
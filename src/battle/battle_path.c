@@ -0,0 +1,176 @@
+#include "battle_path.h"
+#include "battle.h"
+#include "../field/tilemap.h"
+#include <string.h>
+
+_Static_assert(PARTY_MAX + BATTLE_MAX_ENEMIES <= BATTLE_PATH_BODIES,
+               "BATTLE_PATH_BODIES must cover every combatant");
+
+#define PATH_BLOCKED 0xFFFFu
+
+static const int kDx[4] = { 1, -1, 0, 0 };
+static const int kDy[4] = { 0, 0, 1, -1 };
+
+void BattlePathsReset(BattlePaths *p)
+{
+    for (int i = 0; i < BATTLE_PATH_FIELDS; i++) p->fields[i].built = false;
+    p->nextSlot = 0;
+}
+
+// Body index: party members first, then enemies. -1 for anything else.
+static int BodyIndex(const BattleContext *ctx, const Combatant *c)
+{
+    if (c >= ctx->party->members && c < ctx->party->members + PARTY_MAX)
+        return (int)(c - ctx->party->members);
+    if (c >= ctx->enemies && c < ctx->enemies + BATTLE_MAX_ENEMIES)
+        return PARTY_MAX + (int)(c - ctx->enemies);
+    return -1;
+}
+
+// Where every living combatant stands now, in body order.
+static void SnapshotBodies(const BattleContext *ctx, TilePos out[BATTLE_PATH_BODIES])
+{
+    for (int i = 0; i < BATTLE_PATH_BODIES; i++) out[i] = (TilePos){ -1, -1 };
+    for (int i = 0; i < ctx->party->count; i++) {
+        const Combatant *c = &ctx->party->members[i];
+        if (c->alive) out[i] = (TilePos){ c->tileX, c->tileY };
+    }
+    for (int i = 0; i < ctx->enemyCount; i++) {
+        const Combatant *c = &ctx->enemies[i];
+        if (c->alive) out[PARTY_MAX + i] = (TilePos){ c->tileX, c->tileY };
+    }
+}
+
+static bool SameTile(TilePos a, TilePos b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+static bool FieldStillHolds(const BattlePathField *f, const TilePos now[BATTLE_PATH_BODIES],
+                            int self)
+{
+    for (int i = 0; i < BATTLE_PATH_BODIES; i++) {
+        if (SameTile(now[i], f->bodyAt[i])) continue;
+        if (i == self && f->mover == self && SameTile(now[i], f->moverAt)) continue;
+        return false;
+    }
+    return true;
+}
+
+static int LocalIndex(const BattlePathField *f, int x, int y)
+{
+    int lx = x - f->originX, ly = y - f->originY;
+    if (lx < 0 || ly < 0 || lx >= BATTLE_PATH_DIAM || ly >= BATTLE_PATH_DIAM) return -1;
+    return ly * BATTLE_PATH_DIAM + lx;
+}
+
+// Breadth-first flood from the goal over the window. Occupied tiles are
+// stamped blocked up front so the flood never tests combatants per cell.
+static void BuildField(BattlePaths *p, BattlePathField *f, const TileMap *m,
+                       TilePos goal, const TilePos bodies[BATTLE_PATH_BODIES])
+{
+    if (++p->epoch == 0) {
+        // Wrapped: stale stamps could now collide, so pay for one clear.
+        for (int i = 0; i < BATTLE_PATH_FIELDS; i++) {
+            memset(p->fields[i].stamp, 0, sizeof(p->fields[i].stamp));
+            p->fields[i].built = false;
+        }
+        p->epoch = 1;
+    }
+    p->builds++;
+
+    f->built   = true;
+    f->map     = m;
+    f->goal    = goal;
+    f->originX = goal.x - BATTLE_PATH_RADIUS;
+    f->originY = goal.y - BATTLE_PATH_RADIUS;
+    f->epoch   = p->epoch;
+    f->mover   = -1;
+    memcpy(f->bodyAt, bodies, sizeof(f->bodyAt));
+
+    for (int i = 0; i < BATTLE_PATH_BODIES; i++) {
+        int idx = bodies[i].x < 0 ? -1 : LocalIndex(f, bodies[i].x, bodies[i].y);
+        if (idx < 0) continue;
+        f->stamp[idx] = f->epoch;
+        f->dist[idx]  = PATH_BLOCKED;
+    }
+
+    // The goal is passable even with the target standing on it, so paths
+    // can end next to it.
+    int goalIdx = LocalIndex(f, goal.x, goal.y);
+    f->stamp[goalIdx] = f->epoch;
+    f->dist[goalIdx]  = 0;
+
+    int qHead = 0, qTail = 0;
+    p->queue[qTail++] = goalIdx;
+    while (qHead < qTail) {
+        int cur = p->queue[qHead++];
+        int cx  = cur % BATTLE_PATH_DIAM;
+        int cy  = cur / BATTLE_PATH_DIAM;
+        for (int d = 0; d < 4; d++) {
+            int nlx = cx + kDx[d];
+            int nly = cy + kDy[d];
+            if (nlx < 0 || nly < 0 || nlx >= BATTLE_PATH_DIAM || nly >= BATTLE_PATH_DIAM) continue;
+            int nIdx = nly * BATTLE_PATH_DIAM + nlx;
+            if (f->stamp[nIdx] == f->epoch) continue;
+            int wx = f->originX + nlx;
+            int wy = f->originY + nly;
+            if (wx < 0 || wy < 0 || wx >= m->width || wy >= m->height) continue;
+            if (TileMapIsSolid(m, wx, wy)) continue;
+            if (TileMapGetFlags(m, wx, wy) & TILE_FLAG_WARP) continue;
+            f->stamp[nIdx] = f->epoch;
+            f->dist[nIdx]  = (uint16_t)(f->dist[cur] + 1);
+            p->queue[qTail++] = nIdx;
+        }
+    }
+}
+
+static BattlePathField *FieldFor(BattlePaths *p, const TileMap *m, TilePos goal,
+                                 const TilePos bodies[BATTLE_PATH_BODIES], int self)
+{
+    BattlePathField *f = NULL;
+    for (int i = 0; i < BATTLE_PATH_FIELDS; i++) {
+        BattlePathField *c = &p->fields[i];
+        if (c->built && c->map == m && SameTile(c->goal, goal)) { f = c; break; }
+    }
+    if (f && FieldStillHolds(f, bodies, self)) return f;
+    if (!f) {
+        f = &p->fields[p->nextSlot];
+        p->nextSlot = (p->nextSlot + 1) % BATTLE_PATH_FIELDS;
+    }
+    BuildField(p, f, m, goal, bodies);
+    return f;
+}
+
+TilePos BattlePathsNextStep(BattlePaths *p, const TileMap *m, const BattleContext *ctx,
+                            const Combatant *actor, TilePos goal)
+{
+    TilePos here = { actor->tileX, actor->tileY };
+    if (SameTile(here, goal)) return here;
+    // Out of the window in either axis: the old actor-centred BFS gave up
+    // on exactly these, so don't flood for them.
+    int adx = here.x - goal.x, ady = here.y - goal.y;
+    if (adx < -BATTLE_PATH_RADIUS || adx > BATTLE_PATH_RADIUS ||
+        ady < -BATTLE_PATH_RADIUS || ady > BATTLE_PATH_RADIUS) return here;
+
+    TilePos bodies[BATTLE_PATH_BODIES];
+    SnapshotBodies(ctx, bodies);
+    int self = BodyIndex(ctx, actor);
+    BattlePathField *f = FieldFor(p, m, goal, bodies, self);
+
+    TilePos  best     = here;
+    unsigned bestDist = PATH_BLOCKED;
+    for (int d = 0; d < 4; d++) {
+        int idx = LocalIndex(f, here.x + kDx[d], here.y + kDy[d]);
+        if (idx < 0 || f->stamp[idx] != f->epoch) continue;
+        if (f->dist[idx] < bestDist) {
+            bestDist = f->dist[idx];
+            best     = (TilePos){ here.x + kDx[d], here.y + kDy[d] };
+        }
+    }
+    if (self >= 0 && !SameTile(best, here)) {
+        f->mover   = self;
+        f->moverAt = best;
+    }
+    return best;
+}
@@ -0,0 +1,72 @@
+#ifndef BATTLE_PATH_H
+#define BATTLE_PATH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "party.h"
+#include "battle_grid.h"
+
+//----------------------------------------------------------------------------------
+// Enemy AI pathing service. Instead of a fresh BFS from every enemy for every
+// step, it floods a distance field outward from the goal (a party member's
+// tile) and reads each step off it: move to the 4-neighbour with the smallest
+// distance. Fields are cached per goal and reused while the board they were
+// built on still holds:
+//
+//   - every other combatant is where it stood at build time (living ones
+//     block; the goal tile itself is always passable), and
+//   - the asking enemy is either where it stood, or has only taken steps
+//     this field handed out. A step always goes downhill, so the tile it
+//     left can never shorten its remaining path and the field stays exact.
+//
+// So an enemy's whole 2-3 step walk costs one flood, and enemies that share
+// a target on an unchanged board share the flood. Cells are epoch-stamped,
+// so a rebuild never clears the buffers. All state lives in the BattlePaths
+// passed in (one per BattleContext): no function statics.
+//----------------------------------------------------------------------------------
+
+// We never flood more than this many tiles in each direction from the goal.
+// Dungeons are finite and small; a 24-tile radius covers every playable floor
+// with room to spare.
+#define BATTLE_PATH_RADIUS 24
+#define BATTLE_PATH_DIAM   (BATTLE_PATH_RADIUS * 2 + 1)
+#define BATTLE_PATH_CELLS  (BATTLE_PATH_DIAM * BATTLE_PATH_DIAM)
+#define BATTLE_PATH_FIELDS PARTY_MAX     // one per party member enemies chase
+#define BATTLE_PATH_BODIES 16            // >= PARTY_MAX + BATTLE_MAX_ENEMIES
+
+struct TileMap;
+struct BattleContext;
+
+typedef struct BattlePathField {
+    bool                  built;
+    const struct TileMap *map;
+    TilePos               goal;
+    int                   originX, originY;          // window's world top-left
+    uint32_t              epoch;                     // stamp[i] == epoch: dist[i] is this field's
+    TilePos               bodyAt[BATTLE_PATH_BODIES]; // living combatants at build time, x < 0 = none
+    int                   mover;                     // body that walked this field since, or -1
+    TilePos               moverAt;
+    uint32_t              stamp[BATTLE_PATH_CELLS];
+    uint16_t              dist[BATTLE_PATH_CELLS];
+} BattlePathField;
+
+typedef struct BattlePaths {
+    BattlePathField fields[BATTLE_PATH_FIELDS];
+    int             nextSlot;                   // round-robin eviction
+    uint32_t        epoch;
+    int             queue[BATTLE_PATH_CELLS];   // flood scratch
+    int             builds;                     // floods so far, for ddkp_bench / tuning
+} BattlePaths;
+
+// Drop every cached field. BattleBegin calls it; so can anything that edits
+// tiles mid-battle.
+void BattlePathsReset(BattlePaths *p);
+
+// First step of a shortest 4-connected path from actor toward goal, or the
+// actor's own tile if there is none within the window. Passability is the
+// combat rule: in bounds, not solid, not a warp, no living combatant.
+TilePos BattlePathsNextStep(BattlePaths *p, const struct TileMap *m,
+                            const struct BattleContext *ctx,
+                            const Combatant *actor, TilePos goal);
+
+#endif // BATTLE_PATH_H
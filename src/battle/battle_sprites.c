@@ -2,6 +2,7 @@
 #include "../data/creature_defs.h"
 #include "../field/enemy_sprites.h"
 #include "../render/paper_harbor.h"
+#include "../render/sprite_atlas.h"
 
 // Tint helper: multiplies alpha, or replaces with white when flashing. All
 // per-creature draw helpers funnel colors through this so the flash frame
@@ -75,6 +76,15 @@ static void DrawJanSprite(Rectangle r, bool faceLeft, float alpha, bool flash)
                   (int)(sz * 0.14f), (int)(sz * 0.08f), orange);
 }
 
+// SpriteBakeFn adapters: the atlas keys on dir, so faceLeft travels as the
+// field's dir 1 (left) / 2 (right).
+static void BakeJanSprite(int variant, int dir, int frame, float alpha,
+                          bool flash, Rectangle r)
+{
+    (void)variant; (void)frame;
+    DrawJanSprite(r, dir == 1, alpha, flash);
+}
+
 // ----- Shared sailor (procedural rounded) -------------------------------
 // Delegates to the field's procedural sailor — same rounded visual
 // language as the Elder Penguin / Seal. Facing-row is picked by `faceLeft`
@@ -163,6 +173,13 @@ static void DrawSealSprite(Rectangle r, bool faceLeft, float alpha, bool flash)
     }
 }
 
+static void BakeSealSprite(int variant, int dir, int frame, float alpha,
+                           bool flash, Rectangle r)
+{
+    (void)variant; (void)frame;
+    DrawSealSprite(r, dir == 1, alpha, flash);
+}
+
 // ----- Dispatch ----------------------------------------------------------
 void DrawCombatantSprite(int creatureId, Rectangle r, bool isEnemy,
                          float alpha, float slideX, float slideY, bool flashWhite)
@@ -192,12 +209,16 @@ void DrawCombatantSprite(int creatureId, Rectangle r, bool isEnemy,
     bool faceLeft = isEnemy;
 
     switch (creatureId) {
-        case CREATURE_JAN:          DrawJanSprite(rr,      faceLeft, alpha, flashWhite); break;
+        case CREATURE_JAN:
+            SpriteAtlasDraw(BakeJanSprite, 0, faceLeft ? 1 : 2, 0, rr, alpha, flashWhite);
+            break;
         case CREATURE_DECKHAND:     DrawDeckhandSprite(rr, faceLeft, alpha, flashWhite); break;
         case CREATURE_BOSUN:        DrawBosunSprite(rr,    faceLeft, alpha, flashWhite); break;
         case CREATURE_FIRST_MATE:      DrawCaptainSprite(rr,  faceLeft, alpha, flashWhite); break;
         case CREATURE_CAPTAIN_BOSS: DrawCaptainSprite(rr,  faceLeft, alpha, flashWhite); break;
-        case CREATURE_SEAL:         DrawSealSprite(rr,     faceLeft, alpha, flashWhite); break;
+        case CREATURE_SEAL:
+            SpriteAtlasDraw(BakeSealSprite, 0, faceLeft ? 1 : 2, 0, rr, alpha, flashWhite);
+            break;
         default: {
             // Fallback: the old colored box, so unknown creatures still render.
             Color c = isEnemy ? (Color){0xA8, 0x50, 0x54, 255} : (Color){0x50, 0x68, 0xA0, 255};
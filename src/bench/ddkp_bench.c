@@ -0,0 +1,393 @@
+// ddkp_bench — micro-benchmarks for the game's hot kernels, run against the
+// SDL3 shim in headless null mode (no window; text still measures with the
+// real font). Every input is seeded, so two builds run the same work and
+// their numbers can be compared directly.
+//
+//   ddkp_bench [--json <path>] [--filter <substr>] [--reps <n>] [--min-ms <ms>]
+//
+// Each benchmark is calibrated to at least --min-ms per repetition, then
+// run --reps times; the JSON reports ns per operation (median / min / max
+// over the reps). Results go to stdout unless --json names a file.
+
+#include "raylib.h"
+#include "../screens.h"
+#include "../screen_layout.h"
+#include "../battle/battle.h"
+#include "../battle/battle_grid.h"
+#include "../data/creature_defs.h"
+#include "../data/lore_text.h"
+#include "../data/move_defs.h"
+#include "../field/field.h"
+#include "../field/map_dungeon_proc.h"
+#include "../field/map_source.h"
+#include "../render/paper_harbor.h"
+#include "../state/game_state.h"
+#include "../state/save.h"
+#include "../systems/dialogue.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Globals the game sources expect from an entry point.
+GameScreen currentScreen = GAMEPLAY;
+Font  font  = {0};
+Music music = {0};
+Sound fxCoin = {0};
+
+#define BENCH_PAIRS       1024
+#define BENCH_PROC_FLOOR  4
+#define BENCH_PROC_SEED   0x5EEDu
+#define BENCH_MAX_REPS    32
+
+// Keeps results observable so the compiler can't drop the work.
+static volatile uint64_t gSink;
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Small LCG so fixtures don't depend on the backend's GetRandomValue.
+static uint32_t gRng = 0x2545F491u;
+static int BenchRand(int n)
+{
+    gRng = gRng * 1664525u + 1013904223u;
+    return (int)((gRng >> 8) % (uint32_t)n);
+}
+
+//----------------------------------------------------------------------------------
+// Fixtures: one procedural floor with its enemies, a two-member party placed
+// at the spawn, and a battle context holding the nearest enemies.
+//----------------------------------------------------------------------------------
+static GameState     gGs;
+static FieldState    gField;
+static BattleContext gBattle;
+static TilePos       gPairA[BENCH_PAIRS], gPairB[BENCH_PAIRS];
+static FieldState    gBuildScratch;
+
+static void BuildFloor(FieldState *f, int floor, unsigned seed)
+{
+    int spawnX = 0, spawnY = 0, spawnDir = 0;
+    f->npcCount = f->enemyCount = f->warpCount = f->objectCount = 0;
+    MapBuildContext ctx = {
+        .map         = &f->map,
+        .npcs        = f->npcs,
+        .npcCount    = &f->npcCount,
+        .npcMax      = FIELD_MAX_NPCS,
+        .enemies     = f->enemies,
+        .enemyCount  = &f->enemyCount,
+        .enemyMax    = FIELD_MAX_ENEMIES,
+        .warps       = f->warps,
+        .warpCount   = &f->warpCount,
+        .warpMax     = FIELD_MAX_WARPS,
+        .objects     = f->objects,
+        .objectCount = &f->objectCount,
+        .objectMax   = FIELD_MAX_OBJECTS,
+        .spawnTileX  = &spawnX,
+        .spawnTileY  = &spawnY,
+        .spawnDir    = &spawnDir,
+    };
+    BuildHarborProcFloor(&ctx, floor, seed);
+    PlayerInit(&f->player, spawnX, spawnY);
+    f->player.dir = spawnDir;
+}
+
+static bool Walkable(const TileMap *m, int x, int y)
+{
+    return x >= 0 && y >= 0 && x < m->width && y < m->height && !TileMapIsSolid(m, x, y);
+}
+
+static void SetupFixtures(void)
+{
+    GameStateInit(&gGs);
+    PartyAddMember(&gGs.party, CREATURE_SEAL, 5);
+    gGs.currentMapId   = MAP_HARBOR_PROC;
+    gGs.currentFloor   = BENCH_PROC_FLOOR;
+    gGs.currentMapSeed = BENCH_PROC_SEED;
+
+    BuildFloor(&gField, BENCH_PROC_FLOOR, BENCH_PROC_SEED);
+    gField.gs = &gGs;
+    FieldSyncGrid(&gField);
+    const TileMap *m = &gField.map;
+
+    // Party on the spawn tile and its first open neighbour.
+    int px = gField.player.tileX, py = gField.player.tileY;
+    gGs.party.members[0].tileX = px;
+    gGs.party.members[0].tileY = py;
+    static const int ndx[4] = { 1, -1, 0, 0 };
+    static const int ndy[4] = { 0, 0, 1, -1 };
+    for (int d = 0; d < 4; d++) {
+        if (!Walkable(m, px + ndx[d], py + ndy[d])) continue;
+        gGs.party.members[1].tileX = px + ndx[d];
+        gGs.party.members[1].tileY = py + ndy[d];
+        break;
+    }
+
+    gBattle.party = &gGs.party;
+    gBattle.map   = m;
+    for (int i = 0; i < gField.enemyCount && gBattle.enemyCount < BATTLE_MAX_ENEMIES; i++) {
+        const FieldEnemy *fe = &gField.enemies[i];
+        if (!fe->active) continue;
+        Combatant *c = &gBattle.enemies[gBattle.enemyCount];
+        CombatantInit(c, fe->creatureId, fe->level);
+        c->tileX = fe->tileX;
+        c->tileY = fe->tileY;
+        gBattle.enemyFieldIdx[gBattle.enemyCount++] = i;
+    }
+
+    // Open-tile pairs up to 7 apart: the range the battle and aggro checks ask.
+    for (int i = 0; i < BENCH_PAIRS; i++) {
+        int ax, ay, bx, by;
+        do { ax = BenchRand(m->width); ay = BenchRand(m->height); } while (!Walkable(m, ax, ay));
+        do { bx = ax + BenchRand(15) - 7; by = ay + BenchRand(15) - 7; } while (!Walkable(m, bx, by));
+        gPairA[i] = (TilePos){ ax, ay };
+        gPairB[i] = (TilePos){ bx, by };
+    }
+
+    fprintf(stderr, "fixture: harbor-proc F%d seed %#x, %dx%d, %d enemies (%d in battle)\n",
+            BENCH_PROC_FLOOR, BENCH_PROC_SEED, m->width, m->height, gField.enemyCount,
+            gBattle.enemyCount);
+}
+
+//----------------------------------------------------------------------------------
+// Benchmarks. Each runs `iters` operations and returns a checksum.
+//----------------------------------------------------------------------------------
+static uint64_t BenchBFSNextStep(long iters)
+{
+    uint64_t acc = 0;
+    if (gBattle.enemyCount == 0) return 0;
+    for (long i = 0; i < iters; i++) {
+        const Combatant *e = &gBattle.enemies[i % gBattle.enemyCount];
+        const Combatant *t = &gGs.party.members[i & 1];
+        TilePos next = BFSNextStep(&gField.map, &gBattle, e, (TilePos){ t->tileX, t->tileY });
+        acc += (uint64_t)(next.x * 31 + next.y);
+    }
+    return acc;
+}
+
+// Same queries with the field cache dropped each time: the cost of a flood.
+static uint64_t BenchBFSNextStepCold(long iters)
+{
+    uint64_t acc = 0;
+    if (gBattle.enemyCount == 0) return 0;
+    for (long i = 0; i < iters; i++) {
+        const Combatant *e = &gBattle.enemies[i % gBattle.enemyCount];
+        const Combatant *t = &gGs.party.members[i & 1];
+        BattlePathsReset(&gBattle.paths);
+        TilePos next = BFSNextStep(&gField.map, &gBattle, e, (TilePos){ t->tileX, t->tileY });
+        acc += (uint64_t)(next.x * 31 + next.y);
+    }
+    return acc;
+}
+
+static uint64_t BenchTileHasLOS(long iters)
+{
+    uint64_t acc = 0;
+    for (long i = 0; i < iters; i++) {
+        int k = (int)(i & (BENCH_PAIRS - 1));
+        acc += TileHasLOS(&gField.map, gPairA[k], gPairB[k]);
+    }
+    return acc;
+}
+
+static uint64_t BenchTileMoveReaches(long iters)
+{
+    uint64_t acc = 0;
+    for (long i = 0; i < iters; i++) {
+        int k = (int)(i & (BENCH_PAIRS - 1));
+        int range = (i >> 10) & 1 ? RANGE_RANGED : RANGE_MELEE;
+        acc += TileMoveReaches(&gField.map, gPairA[k], gPairB[k], range);
+    }
+    return acc;
+}
+
+static uint64_t BenchEnemyCheckLoS(long iters)
+{
+    uint64_t acc = 0;
+    if (gField.enemyCount == 0) return 0;
+    for (long i = 0; i < iters; i++) {
+        FieldEnemy e = gField.enemies[i % gField.enemyCount];   // it turns to face
+        int k = (int)((i / gField.enemyCount) & (BENCH_PAIRS - 1));
+        acc += EnemyCheckLoS(&e, &gField.map, gPairB[k].x, gPairB[k].y);
+    }
+    return acc;
+}
+
+static uint64_t BenchAggroCluster(long iters)
+{
+    uint64_t acc = 0;
+    int out[BATTLE_MAX_ENEMIES];
+    if (gField.enemyCount == 0) return 0;
+    for (long i = 0; i < iters; i++) {
+        // Walk the player around so range and sight answers vary.
+        int k = (int)((i / gField.enemyCount) & (BENCH_PAIRS - 1));
+        gField.player.tileX = gPairA[k].x;
+        gField.player.tileY = gPairA[k].y;
+        acc += (uint64_t)FieldEnemyAggroCluster(&gField, (int)(i % gField.enemyCount),
+                                                out, BATTLE_MAX_ENEMIES);
+    }
+    gField.player.tileX = gGs.party.members[0].tileX;
+    gField.player.tileY = gGs.party.members[0].tileY;
+    return acc;
+}
+
+// One floor per seed, cycling the procedural floors 2..5.
+static uint64_t BenchBuildProcFloor(long iters)
+{
+    uint64_t acc = 0;
+    for (long i = 0; i < iters; i++) {
+        BuildFloor(&gBuildScratch, 2 + (int)(i & 3), (unsigned)i * 2654435761u);
+        acc += (uint64_t)(gBuildScratch.enemyCount + gBuildScratch.map.width);
+    }
+    return acc;
+}
+
+// A new seed per call, so every line misses the point cache.
+static uint64_t BenchWobblePoints(long iters)
+{
+    uint64_t acc = 0;
+    for (long i = 0; i < iters; i++) {
+        int count = 0;
+        Vector2 a = { 20.0f, 40.0f + (float)(i & 63) };
+        Vector2 b = { 420.0f, 90.0f };
+        const Vector2 *pts = PHWobblePoints(a, b, 2.0f, (int)i, &count);
+        acc += (uint64_t)count + (uint64_t)pts[count / 2].y;
+    }
+    return acc;
+}
+
+// DialogueBegin is a WrapText per page; the pages are the logbook text.
+static uint64_t BenchWrapText(long iters)
+{
+    static DialogueBox box;
+    uint64_t acc = 0;
+    for (long i = 0; i < iters; i++) {
+        int pageCount = 0;
+        const char *const *pages = GetLoreText((int)(i % LORE_COUNT), &pageCount);
+        if (!pages) continue;
+        DialogueBegin(&box, (const char **)pages, pageCount, 30.0f);
+        acc += (uint64_t)box.pages[0][0];
+    }
+    return acc;
+}
+
+static uint64_t BenchSaveLoad(long iters)
+{
+    uint64_t acc = 0;
+    GameState back;
+    for (long i = 0; i < iters; i++) {
+        int x = 0, y = 0, dir = 0;
+        SaveGame(&gGs, (int)(i & 15), 3, 1);
+        acc += LoadGame(&back, &x, &y, &dir) ? (uint64_t)(x + back.party.count) : 0;
+    }
+    return acc;
+}
+
+typedef struct Bench {
+    const char *name;
+    uint64_t  (*run)(long iters);
+} Bench;
+
+static const Bench kBenches[] = {
+    { "BFSNextStep",            BenchBFSNextStep },
+    { "BFSNextStepCold",        BenchBFSNextStepCold },
+    { "TileHasLOS",             BenchTileHasLOS },
+    { "TileMoveReaches",        BenchTileMoveReaches },
+    { "EnemyCheckLoS",          BenchEnemyCheckLoS },
+    { "FieldEnemyAggroCluster", BenchAggroCluster },
+    { "BuildHarborProcFloor",   BenchBuildProcFloor },
+    { "PHWobblePoints",         BenchWobblePoints },
+    { "WrapText",               BenchWrapText },
+    { "SaveLoadRoundTrip",      BenchSaveLoad },
+};
+#define BENCH_COUNT ((int)(sizeof(kBenches) / sizeof(kBenches[0])))
+
+static int CompareDouble(const void *a, const void *b)
+{
+    double da = *(const double *)a, db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *jsonPath = NULL, *filter = NULL;
+    int    reps  = 7;
+    double minMs = 50.0;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0)        jsonPath = argv[++i];
+        else if (strcmp(argv[i], "--filter") == 0) filter = argv[++i];
+        else if (strcmp(argv[i], "--reps") == 0)   reps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--min-ms") == 0) minMs = atof(argv[++i]);
+    }
+    if (reps < 1) reps = 1;
+    if (reps > BENCH_MAX_REPS) reps = BENCH_MAX_REPS;
+
+    SetHeadlessMode(HEADLESS_NULL);
+    InitWindow(SCREEN_W, SCREEN_H, "ddkp_bench");
+    ChangeDirectory(GetApplicationDirectory());
+
+    // SaveGame writes savegame.dat beside the binary; keep whatever is there
+    // and put it back afterwards.
+    int savedBytes = 0;
+    unsigned char *savedGame = FileExists("savegame.dat")
+                             ? LoadFileData("savegame.dat", &savedBytes) : NULL;
+    font = LoadFontEx("resources/EBGaramond-Bold.ttf", 96, 0, 0);
+    SetupFixtures();
+
+    FILE *out = jsonPath ? fopen(jsonPath, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "ddkp_bench: cannot write %s\n", jsonPath);
+        return 1;
+    }
+    fprintf(out, "{\n\"suite\":\"ddkp_bench\",\n\"reps\":%d,\n\"minMsPerRep\":%.1f,\n"
+                 "\"benchmarks\":[", reps, minMs);
+
+    bool first = true;
+    for (int b = 0; b < BENCH_COUNT; b++) {
+        const Bench *bench = &kBenches[b];
+        if (filter && !strstr(bench->name, filter)) continue;
+
+        // Double the batch until one rep takes minMs.
+        long iters = 1;
+        for (;;) {
+            uint64_t t0 = NowNs();
+            gSink += bench->run(iters);
+            double ms = (double)(NowNs() - t0) / 1.0e6;
+            if (ms >= minMs || iters >= (1L << 30)) break;
+            iters *= 2;
+        }
+
+        double nsPerOp[BENCH_MAX_REPS];
+        for (int r = 0; r < reps; r++) {
+            uint64_t t0 = NowNs();
+            gSink += bench->run(iters);
+            nsPerOp[r] = (double)(NowNs() - t0) / (double)iters;
+        }
+        qsort(nsPerOp, (size_t)reps, sizeof(double), CompareDouble);
+
+        fprintf(out, "%s\n{\"name\":\"%s\",\"iterations\":%ld,\"nsPerOp\":%.2f,"
+                     "\"minNs\":%.2f,\"maxNs\":%.2f}",
+                first ? "" : ",", bench->name, iters, nsPerOp[reps / 2], nsPerOp[0],
+                nsPerOp[reps - 1]);
+        fflush(out);
+        fprintf(stderr, "%-24s %12.1f ns/op\n", bench->name, nsPerOp[reps / 2]);
+        first = false;
+    }
+    fprintf(out, "\n]\n}\n");
+    if (out != stdout) fclose(out);
+
+    if (savedGame) {
+        SaveFileData("savegame.dat", savedGame, savedBytes);
+        UnloadFileData(savedGame);
+    } else {
+        remove("savegame.dat");
+    }
+    UnloadFont(font);
+    CloseWindow();
+    return 0;
+}
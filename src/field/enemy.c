@@ -5,6 +5,7 @@
 #include "../render/paper_harbor.h"
 #include "../screen_layout.h"
 #include <stdlib.h>  // abs
+#include <stdint.h>
 #include <math.h>
 
 // Direction vectors: 0=down, 1=left, 2=right, 3=up
@@ -47,8 +48,8 @@ static bool CheckLoS(const FieldEnemy *e, const TileMap *map,
 
 // Returns true if the enemy can see the player from its current position.
 // If true, sets e->dir to face the player.
-static bool EnemyCheckLoS(FieldEnemy *e, const TileMap *map,
-                           int playerTileX, int playerTileY)
+bool EnemyCheckLoS(FieldEnemy *e, const TileMap *map,
+                   int playerTileX, int playerTileY)
 {
     int facingDir = e->dir;
     if (e->behavior == BEHAVIOR_STAND) {
@@ -117,6 +118,134 @@ static bool BeginStepToward(FieldEnemy *e, const TileMap *map,
     return false;
 }
 
+//----------------------------------------------------------------------------------
+// Chase distance field — walking distance to the player over terrain
+//----------------------------------------------------------------------------------
+
+// One field per floor, shared by every chaser. Rebuilt only when the player
+// changes tile, the map is edited (TileMap.revision) or a fixture comes or
+// goes (FieldState.fixtureRevision); each chaser then steps downhill, so
+// following a real shortest path around pillars and rock seams costs a few
+// reads per step.
+//
+// NPCs and field objects never move, so they are walls to the field: a chest
+// in a one-tile gap sends chasers the long way round instead of parking them
+// behind it. Only the player and other enemies are checked per step.
+#define CHASE_UNREACHED 0xFFFFu
+#define CHASE_BLOCKED   0xFFFEu
+
+static struct {
+    const TileMap *map;
+    unsigned       revision;
+    unsigned       fixtures;        // FieldState.fixtureRevision at the last build
+    int            rootX, rootY;
+    uint16_t       dist[MAP_MAX_W * MAP_MAX_H];
+    uint16_t       queue[MAP_MAX_W * MAP_MAX_H];
+} gChase;
+
+// Terrain: the same tiles EnemyCanEnter allows, minus the occupancy test.
+static bool ChaseWalkable(const TileMap *map, int x, int y)
+{
+    if (TileMapIsSolid(map, x, y)) return false;
+    if (TileMapGetFlags(map, x, y) & TILE_FLAG_WARP) return false;
+    return true;
+}
+
+static void ChaseBlock(const TileMap *map, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= map->width || y >= map->height) return;
+    gChase.dist[y * map->width + x] = CHASE_BLOCKED;
+}
+
+static void ChaseFieldUpdate(const TileMap *map, const struct FieldState *f,
+                             int rootX, int rootY)
+{
+    unsigned fixtures = f ? f->fixtureRevision : 0;
+    if (gChase.map == map && gChase.revision == map->revision &&
+        gChase.fixtures == fixtures &&
+        gChase.rootX == rootX && gChase.rootY == rootY) return;
+    gChase.map      = map;
+    gChase.revision = map->revision;
+    gChase.fixtures = fixtures;
+    gChase.rootX    = rootX;
+    gChase.rootY    = rootY;
+
+    int cells = map->width * map->height;
+    for (int i = 0; i < cells; i++) gChase.dist[i] = CHASE_UNREACHED;
+    if (rootX < 0 || rootY < 0 || rootX >= map->width || rootY >= map->height) return;
+    if (f) {
+        for (int i = 0; i < f->npcCount; i++)
+            if (f->npcs[i].active) ChaseBlock(map, f->npcs[i].tileX, f->npcs[i].tileY);
+        for (int i = 0; i < f->objectCount; i++)
+            if (f->objects[i].active) ChaseBlock(map, f->objects[i].tileX, f->objects[i].tileY);
+    }
+
+    int qHead = 0, qTail = 0;
+    gChase.dist[rootY * map->width + rootX] = 0;
+    gChase.queue[qTail++] = (uint16_t)(rootY * map->width + rootX);
+    while (qHead < qTail) {
+        int cur = gChase.queue[qHead++];
+        int cx  = cur % map->width;
+        int cy  = cur / map->width;
+        for (int d = 0; d < 4; d++) {
+            int nx = cx + DIR_DX[d];
+            int ny = cy + DIR_DY[d];
+            if (nx < 0 || ny < 0 || nx >= map->width || ny >= map->height) continue;
+            int n = ny * map->width + nx;
+            if (gChase.dist[n] != CHASE_UNREACHED) continue;
+            if (!ChaseWalkable(map, nx, ny)) continue;
+            gChase.dist[n] = (uint16_t)(gChase.dist[cur] + 1);
+            gChase.queue[qTail++] = (uint16_t)n;
+        }
+    }
+}
+
+// Steps from (x, y) to the player; CHASE_UNREACHED / CHASE_BLOCKED when the
+// field has none.
+static unsigned ChaseDist(const TileMap *map, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= map->width || y >= map->height) return CHASE_UNREACHED;
+    return gChase.dist[y * map->width + x];
+}
+
+// Start one step down the chase field toward the player. Neighbours one tile
+// closer are tried with the old greedy preference (horizontal toward the
+// player, then vertical) so open-ground chases look the same as before. If
+// the player or another enemy stands on every closer tile the enemy just
+// waits. Enemies the field doesn't reach fall back to the greedy step.
+static bool BeginChaseStep(FieldEnemy *e, const TileMap *map,
+                           const struct FieldState *f, int selfIdx,
+                           int playerTileX, int playerTileY)
+{
+    ChaseFieldUpdate(map, f, playerTileX, playerTileY);
+    unsigned here = ChaseDist(map, e->tileX, e->tileY);
+    if (here >= CHASE_BLOCKED)
+        return BeginStepToward(e, map, f, selfIdx, playerTileX, playerTileY);
+    if (here == 0) return false;
+
+    int dx = playerTileX - e->tileX;
+    int dy = playerTileY - e->tileY;
+    int order[4] = {
+        dx < 0 ? 1 : 2,     // horizontal toward the player
+        dy < 0 ? 3 : 0,     // vertical toward the player
+        dx < 0 ? 2 : 1,
+        dy < 0 ? 0 : 3,
+    };
+    for (int i = 0; i < 4; i++) {
+        int nx = e->tileX + DIR_DX[order[i]];
+        int ny = e->tileY + DIR_DY[order[i]];
+        if (ChaseDist(map, nx, ny) != here - 1) continue;
+        if (f && FieldIsTileOccupied(f, nx, ny, selfIdx)) continue;
+        e->targetTileX = nx;
+        e->targetTileY = ny;
+        e->dir         = order[i];
+        e->moving      = true;
+        e->moveFrames  = 0;
+        return true;
+    }
+    return false;
+}
+
 //----------------------------------------------------------------------------------
 // Public API
 //----------------------------------------------------------------------------------
@@ -306,7 +435,7 @@ bool EnemyUpdate(FieldEnemy *e, const TileMap *map,
             return true;
         }
         if (!e->moving) {
-            BeginStepToward(e, map, f,selfIdx, playerTileX, playerTileY);
+            BeginChaseStep(e, map, f, selfIdx, playerTileX, playerTileY);
         }
         break;
     }
@@ -26,7 +26,7 @@ typedef enum EnemyBehavior {
 typedef enum EnemyAiState {
     ENEMY_IDLE,
     ENEMY_ALERTED,   // spotted player — show "!" and freeze briefly
-    ENEMY_CHASING,   // walking toward player tile-by-tile
+    ENEMY_CHASING,   // following the shared path field to the player
 } EnemyAiState;
 
 typedef struct FieldEnemy {
@@ -101,4 +101,9 @@ bool EnemyUpdate(FieldEnemy *e, const TileMap *map,
 // Draw inside BeginMode2D.
 void EnemyDraw(const FieldEnemy *e);
 
+// True if the enemy can see the player from its current tile (standers look
+// along their facing only, others in all four directions); turns it to face
+// the player when so. Exposed for ddkp_bench.
+bool EnemyCheckLoS(FieldEnemy *e, const TileMap *map, int playerTileX, int playerTileY);
+
 #endif // ENEMY_H
@@ -1,6 +1,7 @@
 #include "enemy_sprites.h"
 #include "../data/creature_defs.h"
 #include "../render/paper_harbor.h"
+#include "../render/sprite_atlas.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <math.h>
@@ -14,13 +15,19 @@
 // All coordinates inside DrawSailor are fractions of `sz` (the shorter
 // side of the bounding rect), so the same code scales from a 48px
 // field tile up to an 80-100px battle cell without distortion.
+//
+// Each (creature, dir, size, flash) pose is baked once into the shared
+// sprite atlas; EnemySpritesDrawSailor blits it with the fade as the tint.
 //----------------------------------------------------------------------------------
 
-// Multiply alpha, or replace with white for the hit-frame flash.
+// Multiply alpha, or replace with white for the hit-frame flash. Palette
+// alpha is snapped to opaque first: the sprite is baked into a transparent
+// render texture, where a 245-alpha parchment hat would come out see-through.
 static Color Tint(Color c, float alpha, bool flash)
 {
-    if (flash) return (Color){255, 255, 255, (unsigned char)(c.a * alpha)};
-    c.a = (unsigned char)(c.a * alpha);
+    unsigned char a = c.a ? 255 : 0;
+    if (flash) return (Color){255, 255, 255, (unsigned char)(a * alpha)};
+    c.a = (unsigned char)(a * alpha);
     return c;
 }
 
@@ -103,12 +110,11 @@ static SailorStyle StyleForCreature(int creatureId, float alpha, bool flash)
 // as the F10 preview's `PH_DrawCharacter`: rounded torso rect, sash stripe,
 // yellow head circle, two eye dots, hat. No V-collar, hands, feet, or beard
 // detail — just five shapes. Rank is read from coat color + hat shape alone.
-void EnemySpritesDrawSailor(int creatureId, Rectangle r, int dir, int frame,
-                            float alpha, bool flashWhite)
+// SpriteBakeFn signature; `frame` is unused (no walk cycle).
+static void DrawSailor(int creatureId, int dir, int frame, float alpha,
+                       bool flashWhite, Rectangle r)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    if (alpha > 1.0f) alpha = 1.0f;
-    (void)frame;  // No walk cycle — sailors idle-bob via caller, not here.
+    (void)frame;
 
     SailorStyle s = StyleForCreature(creatureId, alpha, flashWhite);
 
@@ -235,5 +241,16 @@ void EnemySpritesDrawSailor(int creatureId, Rectangle r, int dir, int frame,
     }
 }
 
-void EnemySpritesReload(void) { /* no-op: procedural draws have no resources */ }
-void EnemySpritesUnload(void) { /* no-op */ }
+void EnemySpritesDrawSailor(int creatureId, Rectangle r, int dir, int frame,
+                            float alpha, bool flashWhite)
+{
+    // No walk cycle — sailors idle-bob via caller, so every frame shares
+    // one baked pose.
+    (void)frame;
+    SpriteAtlasDraw(DrawSailor, creatureId, dir, 0, r, alpha, flashWhite);
+}
+
+// The atlas is shared with the NPCs and Jan; the field lifecycle hooks here
+// are where it gets dropped (reload: re-bake lazily, unload: free pages).
+void EnemySpritesReload(void) { SpriteAtlasReset(); }
+void EnemySpritesUnload(void) { SpriteAtlasUnload(); }
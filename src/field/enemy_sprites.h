@@ -5,7 +5,8 @@
 
 // Procedural rounded sailor drawing — matches the Elder Penguin / Seal
 // visual style from the field (DrawRectangleRounded + DrawCircle +
-// DrawTriangle primitives). No texture atlases, no caching.
+// DrawTriangle primitives), baked per pose into the shared sprite atlas
+// (render/sprite_atlas.h) and blitted from there.
 //
 //   dir:        0=down, 1=left, 2=right, 3=up
 //   frame:      0 or 1 (walk animation wobble)
@@ -14,8 +15,8 @@
 void EnemySpritesDrawSailor(int creatureId, Rectangle r, int dir, int frame,
                             float alpha, bool flashWhite);
 
-// Kept as no-ops so the field lifecycle hooks (ReloadResources / Unload)
-// continue to compile without special-casing the switch to procedural art.
+// Field lifecycle hooks for the sprite atlas: Reload forgets every baked
+// pose (re-baked on next draw), Unload frees the atlas textures.
 void EnemySpritesReload(void);
 void EnemySpritesUnload(void);
 
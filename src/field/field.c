@@ -3,6 +3,7 @@
 #include "buildings.h"
 #include "enemy_sprites.h"
 #include "map_source.h"
+#include "tile_los.h"
 #include "village.h"
 #include "../state/game_state.h"
 #include "../state/save.h"
@@ -16,6 +17,8 @@
 #include "../render/paper_harbor.h"
 #include "../systems/touch_input.h"
 #include "../systems/fab_menu.h"
+#include "../systems/profiler.h"
+#include "../systems/trace.h"
 #include "../screen_layout.h"
 #include <string.h>
 #include <stdio.h>
@@ -58,32 +61,118 @@ static bool IsInteractPressed(void)
     return TouchTapOccurred(NULL);
 }
 
-bool FieldIsTileOccupied(const FieldState *ow, int x, int y, int ignoreEnemyIdx)
+// FieldGrid handles: the player, then NPCs, enemies and objects by slot.
+#define GRID_PLAYER  0
+#define GRID_NPC0    1
+#define GRID_ENEMY0  (GRID_NPC0 + FIELD_MAX_NPCS)
+#define GRID_OBJECT0 (GRID_ENEMY0 + FIELD_MAX_ENEMIES)
+_Static_assert(GRID_OBJECT0 + FIELD_MAX_OBJECTS <= FIELD_GRID_MAX_HANDLES,
+               "FIELD_GRID_MAX_HANDLES must cover every field entity");
+
+static void GridSyncPlayer(FieldState *ow)
 {
-    // Player — include both current tile and the tile being stepped into.
-    if (ow->player.tileX == x && ow->player.tileY == y) return true;
-    if (ow->player.moving && ow->player.targetTileX == x && ow->player.targetTileY == y)
-        return true;
-    // NPCs
-    for (int i = 0; i < ow->npcCount; i++) {
+    const Player *p = &ow->player;
+    FieldGridPlace(&ow->grid, GRID_PLAYER, p->tileX, p->tileY,
+                   p->moving, p->targetTileX, p->targetTileY);
+}
+
+static void GridSyncEnemy(FieldState *ow, int i)
+{
+    const FieldEnemy *e = &ow->enemies[i];
+    if (!e->active) { FieldGridRemove(&ow->grid, GRID_ENEMY0 + i); return; }
+    FieldGridPlace(&ow->grid, GRID_ENEMY0 + i, e->tileX, e->tileY,
+                   e->moving, e->targetTileX, e->targetTileY);
+}
+
+// NPCs and objects stand still, so their claims only change when one comes,
+// goes or is placed; each change takes a fresh fixtureRevision. Global like
+// the tile map revision, so a new FieldState never repeats an old value.
+static unsigned gFixtureRevision = 0;
+
+static void GridSyncFixture(FieldState *ow, int handle, bool present, int x, int y)
+{
+    FieldGrid *g = &ow->grid;
+    int c = handle * 2;
+    bool same = present ? g->held[c] && g->claimX[c] == x && g->claimY[c] == y
+                        : !g->held[c];
+    if (same) return;
+    ow->fixtureRevision = ++gFixtureRevision;
+    if (present) FieldGridPlace(g, handle, x, y, false, 0, 0);
+    else         FieldGridRemove(g, handle);
+}
+
+void FieldSyncGrid(FieldState *ow)
+{
+    FieldGrid *g = &ow->grid;
+    if (g->width != ow->map.width || g->height != ow->map.height)
+        FieldGridReset(g, ow->map.width, ow->map.height);
+    GridSyncPlayer(ow);
+    for (int i = 0; i < FIELD_MAX_NPCS; i++) {
         const Npc *n = &ow->npcs[i];
-        if (!n->active) continue;
-        if (n->tileX == x && n->tileY == y) return true;
+        GridSyncFixture(ow, GRID_NPC0 + i, i < ow->npcCount && n->active, n->tileX, n->tileY);
     }
-    // Enemies
-    for (int i = 0; i < ow->enemyCount; i++) {
-        if (i == ignoreEnemyIdx) continue;
-        const FieldEnemy *e = &ow->enemies[i];
-        if (!e->active) continue;
-        if (e->tileX == x && e->tileY == y) return true;
-        if (e->moving && e->targetTileX == x && e->targetTileY == y) return true;
+    for (int i = 0; i < FIELD_MAX_ENEMIES; i++) {
+        if (i < ow->enemyCount) GridSyncEnemy(ow, i);
+        else                    FieldGridRemove(g, GRID_ENEMY0 + i);
     }
-    // Field objects — chests, lanterns, logbooks all read as obstacles. Even
-    // a "consumed" lantern still occupies its tile (the post stays standing).
-    for (int i = 0; i < ow->objectCount; i++) {
+    for (int i = 0; i < FIELD_MAX_OBJECTS; i++) {
         const FieldObject *o = &ow->objects[i];
-        if (!o->active) continue;
-        if (o->tileX == x && o->tileY == y) return true;
+        GridSyncFixture(ow, GRID_OBJECT0 + i, i < ow->objectCount && o->active,
+                        o->tileX, o->tileY);
+    }
+}
+
+// Enemy index behind a claim on the tile it stands on, or -1 (other kinds,
+// or the tile an enemy is stepping into).
+static int GridStandingEnemy(int claim)
+{
+    int h = FIELD_GRID_HANDLE(claim);
+    if (FIELD_GRID_STEPPING(claim) || h < GRID_ENEMY0 || h >= GRID_OBJECT0) return -1;
+    return h - GRID_ENEMY0;
+}
+
+// Lowest-index active NPC / object on (x, y), or -1.
+static int GridNpcAt(const FieldState *ow, int x, int y)
+{
+    int best = -1;
+    for (int c = FieldGridFirst(&ow->grid, x, y); c >= 0; c = FieldGridNext(&ow->grid, c)) {
+        int h = FIELD_GRID_HANDLE(c);
+        if (h < GRID_NPC0 || h >= GRID_ENEMY0) continue;
+        int i = h - GRID_NPC0;
+        if (ow->npcs[i].active && (best < 0 || i < best)) best = i;
+    }
+    return best;
+}
+
+static int GridObjectAt(const FieldState *ow, int x, int y)
+{
+    int best = -1;
+    for (int c = FieldGridFirst(&ow->grid, x, y); c >= 0; c = FieldGridNext(&ow->grid, c)) {
+        int h = FIELD_GRID_HANDLE(c);
+        if (h < GRID_OBJECT0) continue;
+        int i = h - GRID_OBJECT0;
+        if (ow->objects[i].active && (best < 0 || i < best)) best = i;
+    }
+    return best;
+}
+
+bool FieldIsTileOccupied(const FieldState *ow, int x, int y, int ignoreEnemyIdx)
+{
+    // The grid holds the player's and each enemy's current tile plus, while
+    // mid-step, the tile being stepped into. Field objects read as obstacles
+    // too — even a "consumed" lantern still occupies its tile (the post
+    // stays standing).
+    for (int c = FieldGridFirst(&ow->grid, x, y); c >= 0; c = FieldGridNext(&ow->grid, c)) {
+        int h = FIELD_GRID_HANDLE(c);
+        if (h == GRID_PLAYER) return true;
+        if (h < GRID_ENEMY0) {
+            if (ow->npcs[h - GRID_NPC0].active) return true;
+        } else if (h < GRID_OBJECT0) {
+            int i = h - GRID_ENEMY0;
+            if (i != ignoreEnemyIdx && ow->enemies[i].active) return true;
+        } else if (ow->objects[h - GRID_OBJECT0].active) {
+            return true;
+        }
     }
     return false;
 }
@@ -465,41 +554,50 @@ static int FindSurpriseTarget(const FieldState *ow, int px, int py,
 
     // Melee case — adjacent, directly behind. Uses Jan's strongest MELEE move
     // so an equipped FishingHook / SeaUrchinSpike trumps the bare Tackle.
-    for (int i = 0; i < ow->enemyCount; i++) {
-        const FieldEnemy *e = &ow->enemies[i];
-        if (!e->active) continue;
-        if (e->aiState != ENEMY_IDLE) continue;
-        int behindX = e->tileX - FIELD_DIR_DX[e->dir];
-        int behindY = e->tileY - FIELD_DIR_DY[e->dir];
-        if (px == behindX && py == behindY) {
-            if (outMoveSlot) *outMoveSlot = (meleeSlot >= 0) ? meleeSlot : 0;
-            return i;
+    // Jan is behind an enemy exactly when it stands on his neighbour in
+    // direction d and faces d, so only those four tiles are looked at.
+    int best = -1;
+    for (int d = 0; d < 4; d++) {
+        int x = px + FIELD_DIR_DX[d];
+        int y = py + FIELD_DIR_DY[d];
+        for (int c = FieldGridFirst(&ow->grid, x, y); c >= 0; c = FieldGridNext(&ow->grid, c)) {
+            int i = GridStandingEnemy(c);
+            if (i < 0) continue;
+            const FieldEnemy *e = &ow->enemies[i];
+            if (!e->active || e->aiState != ENEMY_IDLE || e->dir != d) continue;
+            if (best < 0 || i < best) best = i;
         }
     }
+    if (best >= 0) {
+        if (outMoveSlot) *outMoveSlot = (meleeSlot >= 0) ? meleeSlot : 0;
+        return best;
+    }
 
     if (rangedSlot < 0) return -1;
 
     // Ranged case — k=2..3 tiles directly behind the enemy. Require the player
     // to be facing the enemy (same dir as enemy's facing, since looking at the
     // enemy's back means looking the same way they do) and the line to be
-    // clear. RANGE_RANGED caps at Chebyshev 3 — see TileMoveReaches.
-    if (playerDir != -1) {
-        for (int i = 0; i < ow->enemyCount; i++) {
-            const FieldEnemy *e = &ow->enemies[i];
-            if (!e->active) continue;
-            if (e->aiState != ENEMY_IDLE) continue;
-            if (playerDir != e->dir) continue; // aiming somewhere else
-            int dx = FIELD_DIR_DX[e->dir];
-            int dy = FIELD_DIR_DY[e->dir];
-            for (int k = 2; k <= 3; k++) {
-                int bx = e->tileX - dx * k;
-                int by = e->tileY - dy * k;
-                if (px != bx || py != by) continue;
+    // clear. RANGE_RANGED caps at Chebyshev 3 — see TileMoveReaches. So the
+    // enemy stands 2 or 3 tiles ahead of Jan along his facing.
+    if (playerDir >= 0 && playerDir < 4) {
+        for (int k = 2; k <= 3; k++) {
+            int x = px + FIELD_DIR_DX[playerDir] * k;
+            int y = py + FIELD_DIR_DY[playerDir] * k;
+            for (int c = FieldGridFirst(&ow->grid, x, y); c >= 0; c = FieldGridNext(&ow->grid, c)) {
+                int i = GridStandingEnemy(c);
+                if (i < 0 || (best >= 0 && i > best)) continue;
+                const FieldEnemy *e = &ow->enemies[i];
+                if (!e->active || e->aiState != ENEMY_IDLE) continue;
+                if (playerDir != e->dir) continue; // aiming somewhere else
                 if (!FieldAggroLOS(&ow->map, px, py, e->tileX, e->tileY)) continue;
-                if (outMoveSlot) *outMoveSlot = rangedSlot;
-                return i;
+                best = i;
             }
         }
+        if (best >= 0) {
+            if (outMoveSlot) *outMoveSlot = rangedSlot;
+            return best;
+        }
     }
     return -1;
 }
@@ -521,7 +619,7 @@ static int Chebyshev(int ax, int ay, int bx, int by)
 // threads the diagonal seam between two wall tiles. Unlike the Bresenham in
 // battle_grid.c this cannot skip through wall corners. Endpoints themselves
 // are not tested (a participant might stand next to the map edge, etc.).
-static bool FieldAggroLOS(const TileMap *m, int ax, int ay, int bx, int by)
+static bool StrictLOS(const TileMap *m, int ax, int ay, int bx, int by)
 {
     if (ax == bx && ay == by) return true;
 
@@ -549,6 +647,15 @@ static bool FieldAggroLOS(const TileMap *m, int ax, int ay, int bx, int by)
     return true;
 }
 
+// Aggro and surprise checks never look past FIELD_AGGRO_RADIUS, so every
+// one of them is a cached bit test after the first look from a tile.
+static TileLosCache gAggroLos = TILE_LOS_CACHE(FIELD_AGGRO_RADIUS, StrictLOS);
+
+static bool FieldAggroLOS(const TileMap *m, int ax, int ay, int bx, int by)
+{
+    return TileLosCacheTest(&gAggroLos, m, ax, ay, bx, by);
+}
+
 // True if this enemy is currently listed as a captor on any active captive
 // NPC. Captors are treated as "locked" for normal aggro purposes — they only
 // enter a fight when the player initiates the captive-rescue interaction.
@@ -580,8 +687,8 @@ static bool FieldEnemyIsCaptor(const FieldState *ow, int enemyIdx)
 // design) plus any regular enemies within sight. Sibling captors of the same
 // captive are force-included regardless of range/LOS so the rescue scene can't
 // split into two separate fights based on approach geometry.
-static int FieldEnemyAggroCluster(const FieldState *ow, int seedIdx,
-                                  int *outIdxs, int maxOut)
+int FieldEnemyAggroCluster(const FieldState *ow, int seedIdx,
+                           int *outIdxs, int maxOut)
 {
     if (seedIdx < 0 || seedIdx >= ow->enemyCount) return 0;
     if (!ow->enemies[seedIdx].active) return 0;
@@ -625,6 +732,21 @@ static int FieldEnemyAggroCluster(const FieldState *ow, int seedIdx,
     anchorY[anchorCount] = ow->player.tileY;
     anchorCount++;
 
+    // Undetected enemies only count inside FIELD_AGGRO_RADIUS of an anchor;
+    // pick those off the grid around each anchor rather than testing every
+    // enemy on the floor.
+    bool nearAnchor[FIELD_MAX_ENEMIES] = {0};
+    for (int k = 0; k < anchorCount; k++) {
+        for (int y = anchorY[k] - FIELD_AGGRO_RADIUS; y <= anchorY[k] + FIELD_AGGRO_RADIUS; y++) {
+            for (int x = anchorX[k] - FIELD_AGGRO_RADIUS; x <= anchorX[k] + FIELD_AGGRO_RADIUS; x++) {
+                for (int c = FieldGridFirst(&ow->grid, x, y); c >= 0; c = FieldGridNext(&ow->grid, c)) {
+                    int i = GridStandingEnemy(c);
+                    if (i >= 0) nearAnchor[i] = true;
+                }
+            }
+        }
+    }
+
     // Build a list of *eligible* candidates with their min-anchor distance,
     // then add them in nearest-first order so a tight cluster (small
     // BATTLE_MAX_ENEMIES) preserves the closest enemies. Without sorting, a
@@ -641,11 +763,12 @@ static int FieldEnemyAggroCluster(const FieldState *ow, int seedIdx,
             if (outIdxs[j] == i) { already = true; break; }
         }
         if (already) continue;
-        bool iIsCaptor = FieldEnemyIsCaptor(ow, i);
-        if (!seedIsCaptor && iIsCaptor) continue;
         const FieldEnemy *e = &ow->enemies[i];
         bool detected = (e->aiState == ENEMY_ALERTED ||
                          e->aiState == ENEMY_CHASING);
+        if (!detected && !nearAnchor[i]) continue;
+        bool iIsCaptor = FieldEnemyIsCaptor(ow, i);
+        if (!seedIsCaptor && iIsCaptor) continue;
         int bestD = 99999;
         bool inRange = detected;  // detected enemies bypass distance/LOS checks
         if (!detected) {
@@ -891,6 +1014,12 @@ static void StartDungeonBattle(FieldState *ow, int seedIdx,
     BattleBegin(ctx, &ow->gs->party, &ow->map, preemptive);
 }
 
+void FieldStartBattle(FieldState *ow, int enemyIdx)
+{
+    if (enemyIdx < 0 || enemyIdx >= ow->enemyCount) return;
+    StartDungeonBattle(ow, enemyIdx, false, -1, -1, -1);
+}
+
 // Find an active enemy adjacent (Chebyshev ≤ 1) to any party member that could
 // initiate a battle this frame — used by the tile-touch trigger that replaced
 // the old per-enemy `EnemyUpdate` return.
@@ -1219,7 +1348,9 @@ void FieldInit(FieldState *ow, GameState *gs)
     };
     MapBuild((MapId)gs->currentMapId, gs->currentFloor, &ctx, gs->currentMapSeed);
 
+    TraceBegin("TilesetBuild");
     ow->map.tileset = TilesetBuild();
+    TraceEnd();
     PlayerInit(&ow->player, spawnX, spawnY);
     ow->player.dir = spawnDir;
     InventoryUIInit(&ow->invUi);
@@ -1236,6 +1367,7 @@ void FieldInit(FieldState *ow, GameState *gs)
     int mapPixH = ow->map.height * TILE_SIZE * TILE_SCALE;
     Vector2 startPos = PlayerPixelPos(&ow->player);
     ow->camera = CameraCreate(startPos, mapPixW, mapPixH);
+    FieldSyncGrid(ow);
 }
 
 void FieldUpdate(FieldState *ow, float dt)
@@ -1245,6 +1377,19 @@ void FieldUpdate(FieldState *ow, float dt)
     // also receive taps. Calling it again here would clear the tapReady
     // flag mid-frame and silently eat field taps.
 
+#ifdef DEV_BUILD
+    // Frame profiler overlay — F11, alongside the F9/F10 dev hooks below.
+    // Checked ahead of the battle / modal gates since it doesn't take input
+    // focus, and stutter reports are as often mid-battle as in free roam.
+    if (IsKeyPressed(KEY_F11)) ProfToggleOverlay();
+    // F12 starts a trace capture; pressing it again writes trace.json (and
+    // keeps recording). Exit writes it too.
+    if (IsKeyPressed(KEY_F12)) {
+        if (TraceEnabled()) TraceWrite();
+        else                TraceStart(NULL);
+    }
+#endif
+
     // In battle: BattleUpdate owns input. Once it finishes, resolve drops and
     // return to FIELD_FREE.
     if (ow->mode == FIELD_BATTLE) {
@@ -1254,7 +1399,9 @@ void FieldUpdate(FieldState *ow, float dt)
             DialogueUpdate(&ow->dialogue, dt);
             return;
         }
+        ProfBegin(PROF_BATTLE_UPDATE);
         BattleUpdate(&ow->battle, &ow->map, &ow->camera, dt);
+        ProfEnd(PROF_BATTLE_UPDATE);
 
         // Sync field-side sprites from combatant tiles so the player + enemy
         // sprites track the fight. Without this the yellow actor highlight
@@ -1582,8 +1729,12 @@ void FieldUpdate(FieldState *ow, float dt)
         return;
     }
 
-    // Update player movement
+    // Update player movement. The grid is re-synced first to pick up anything
+    // placed outside a step (warps, loads, battle write-back), then after
+    // each entity's update so later queries this frame see its step.
+    FieldSyncGrid(ow);
     PlayerUpdate(&ow->player, &ow->map, ow);
+    GridSyncPlayer(ow);
 
     // One-shot pre-fight taunt on F7 — fires the first time the player comes
     // within 2 tiles (Chebyshev) of the Captain. Gated by captainTauntShown
@@ -1627,14 +1778,7 @@ void FieldUpdate(FieldState *ow, float dt)
             int ady = ddy < 0 ? -ddy : ddy;
             bool ortho = (ddx == 0) ^ (ddy == 0);
             if (ortho && adx + ady == 1) {
-                bool hasTarget = false;
-                for (int i = 0; i < ow->npcCount; i++) {
-                    const Npc *n = &ow->npcs[i];
-                    if (n->active && n->tileX == tx && n->tileY == ty) {
-                        hasTarget = true;
-                        break;
-                    }
-                }
+                bool hasTarget = GridNpcAt(ow, tx, ty) >= 0;
                 if (!hasTarget && tx >= 0 && ty >= 0 &&
                     tx < ow->map.width && ty < ow->map.height &&
                     (TileMapGetFlags(&ow->map, tx, ty) & TILE_FLAG_WARP)) {
@@ -1657,22 +1801,22 @@ void FieldUpdate(FieldState *ow, float dt)
         int tx = ow->player.tileX;
         int ty = ow->player.tileY;
 
-        for (int i = 0; i < ow->npcCount; i++) {
-            if (NpcIsInteractable(&ow->npcs[i], tx, ty, ow->player.dir)) {
-                NpcTurnToFace(&ow->npcs[i], tx, ty);
-                if (NpcCurrentlyCaptive(&ow->npcs[i], ow->enemies, ow->enemyCount)) {
-                    TriggerCaptiveRescueBattle(ow, i);
-                    return;
-                }
-                BeginNpcInteraction(ow, i);
+        int fx = tx + FIELD_DIR_DX[ow->player.dir];
+        int fy = ty + FIELD_DIR_DY[ow->player.dir];
+        int ni = GridNpcAt(ow, fx, fy);
+        if (ni >= 0) {
+            NpcTurnToFace(&ow->npcs[ni], tx, ty);
+            if (NpcCurrentlyCaptive(&ow->npcs[ni], ow->enemies, ow->enemyCount)) {
+                TriggerCaptiveRescueBattle(ow, ni);
                 return;
             }
+            BeginNpcInteraction(ow, ni);
+            return;
         }
-        for (int i = 0; i < ow->objectCount; i++) {
-            if (FieldObjectIsInteractable(&ow->objects[i], tx, ty, ow->player.dir)) {
-                BeginObjectInteraction(ow, i);
-                return;
-            }
+        int oi = GridObjectAt(ow, fx, fy);
+        if (oi >= 0) {
+            BeginObjectInteraction(ow, oi);
+            return;
         }
         if (TryInteractWarp(ow, tx, ty)) return;
     }
@@ -1682,22 +1826,22 @@ void FieldUpdate(FieldState *ow, float dt)
         int tx = ow->player.tileX;
         int ty = ow->player.tileY;
 
-        for (int i = 0; i < ow->npcCount; i++) {
-            if (NpcIsInteractable(&ow->npcs[i], tx, ty, ow->player.dir)) {
-                NpcTurnToFace(&ow->npcs[i], tx, ty);
-                if (NpcCurrentlyCaptive(&ow->npcs[i], ow->enemies, ow->enemyCount)) {
-                    TriggerCaptiveRescueBattle(ow, i);
-                    return;
-                }
-                BeginNpcInteraction(ow, i);
+        int fx = tx + FIELD_DIR_DX[ow->player.dir];
+        int fy = ty + FIELD_DIR_DY[ow->player.dir];
+        int ni = GridNpcAt(ow, fx, fy);
+        if (ni >= 0) {
+            NpcTurnToFace(&ow->npcs[ni], tx, ty);
+            if (NpcCurrentlyCaptive(&ow->npcs[ni], ow->enemies, ow->enemyCount)) {
+                TriggerCaptiveRescueBattle(ow, ni);
                 return;
             }
+            BeginNpcInteraction(ow, ni);
+            return;
         }
-        for (int i = 0; i < ow->objectCount; i++) {
-            if (FieldObjectIsInteractable(&ow->objects[i], tx, ty, ow->player.dir)) {
-                BeginObjectInteraction(ow, i);
-                return;
-            }
+        int oi = GridObjectAt(ow, fx, fy);
+        if (oi >= 0) {
+            BeginObjectInteraction(ow, oi);
+            return;
         }
 
         if (TryInteractWarp(ow, tx, ty)) return;
@@ -1719,7 +1863,10 @@ void FieldUpdate(FieldState *ow, float dt)
     int py = ow->player.tileY;
     for (int i = 0; i < ow->enemyCount; i++) {
         if (!ow->enemies[i].active) continue;
+        ProfBegin(PROF_ENEMY_UPDATE);
         bool triggered = EnemyUpdate(&ow->enemies[i], &ow->map, px, py, dt, ow, i);
+        GridSyncEnemy(ow, i);
+        ProfEnd(PROF_ENEMY_UPDATE);
         if (triggered) {
             StartDungeonBattle(ow, i, false, -1, -1, -1);
             return;
@@ -1846,6 +1993,8 @@ void FieldDraw(const FieldState *ow)
     BeginMode2D(ow->camera);
         DrawWarpMarkers(ow);
 
+        ProfBegin(PROF_ENTITY_DRAW);
+
         // Village: paint the row of Muizenberg-style beach huts over the
         // building footprints (each is a 3x3 grass+SOLID block in the
         // tilemap). Drawn before NPCs so penguins walking past sit in
@@ -1916,6 +2065,7 @@ void FieldDraw(const FieldState *ow)
 
         PlayerDraw(&ow->player);
         DrawPartyFollowersInBattle(ow);
+        ProfEnd(PROF_ENTITY_DRAW);
 
         if (ow->mode == FIELD_BATTLE) {
             BattleDrawWorldOverlay(&ow->battle);
@@ -2077,6 +2227,7 @@ void FieldDraw(const FieldState *ow)
     }
 
     // Battle UI (screen space) — drawn after HUD so bottom-panel menus overlap.
+    ProfBegin(PROF_MODAL_DRAW);
     if (ow->mode == FIELD_BATTLE) {
         BattleDrawUI(&ow->battle);
     }
@@ -2164,6 +2315,7 @@ void FieldDraw(const FieldState *ow)
         DrawChunkyButton(noR,  "NO",  22, false, true);
         DrawChunkyButton(yesR, "YES", 22, true,  true);
     }
+    ProfEnd(PROF_MODAL_DRAW);
 
     // Paper-grain overlay over the whole frame — reads as texture, not noise.
     PHDrawPaperGrain((Rectangle){0, 0, (float)GetScreenWidth(), (float)GetScreenHeight()});
@@ -8,6 +8,7 @@
 #include "npc.h"
 #include "enemy.h"
 #include "field_object.h"
+#include "field_grid.h"
 #include "map_source.h"
 #include "../systems/camera_system.h"
 #include "../systems/dialogue.h"
@@ -59,6 +60,13 @@ typedef struct FieldState {
     FieldObject   objects[FIELD_MAX_OBJECTS];
     int           objectCount;
 
+    // Tile -> entity index over the player, NPCs, enemies and objects, for
+    // occupancy, interaction, aggro and surprise queries. See FieldSyncGrid.
+    FieldGrid     grid;
+    // Changes whenever FieldSyncGrid sees an NPC or object appear, leave or
+    // move; enemy.c rebuilds its chase field on it.
+    unsigned      fixtureRevision;
+
     // Borrowed pointer to the persistent game state (party, inventory, ...).
     struct GameState *gs;
 
@@ -124,4 +132,18 @@ void FieldUnload(FieldState *f);
 // enemy mid-step claims both its current tile and its destination.
 bool FieldIsTileOccupied(const FieldState *f, int x, int y, int ignoreEnemyIdx);
 
+// Brings f->grid up to date with every entity's tiles. FieldInit and
+// FieldUpdate keep it current; call it after placing entities any other way
+// (ddkp_bench builds floors without FieldInit).
+void FieldSyncGrid(FieldState *f);
+
+// Enemies pulled into a battle started by enemy `seedIdx`: the seed, its
+// fellow captors, then others in aggro range and sight, nearest first.
+// Returns the count written to outIdxs. Exposed for ddkp_bench.
+int  FieldEnemyAggroCluster(const FieldState *f, int seedIdx, int *outIdxs, int maxOut);
+
+// Starts an inline battle against enemy `enemyIdx` and its aggro cluster, as
+// if it had just spotted the player. Used by the --bench scenarios.
+void FieldStartBattle(FieldState *f, int enemyIdx);
+
 #endif // FIELD_H
@@ -0,0 +1,59 @@
+#include "field_grid.h"
+#include <string.h>
+
+void FieldGridReset(FieldGrid *g, int width, int height)
+{
+    memset(g, 0, sizeof(*g));
+    g->width  = width;
+    g->height = height;
+}
+
+static void Unlink(FieldGrid *g, int claim)
+{
+    if (!g->held[claim]) return;
+    g->held[claim] = false;
+    unsigned char *link = &g->head[g->claimY[claim] * g->width + g->claimX[claim]];
+    while (*link && *link != claim + 1) link = &g->next[*link - 1];
+    if (*link) *link = g->next[claim];
+    g->next[claim] = 0;
+}
+
+static void Claim(FieldGrid *g, int claim, bool want, int x, int y)
+{
+    if (want && (x < 0 || y < 0 || x >= g->width || y >= g->height)) want = false;
+    if (!want) { Unlink(g, claim); return; }
+    if (g->held[claim] && g->claimX[claim] == x && g->claimY[claim] == y) return;
+    Unlink(g, claim);
+    unsigned char *head = &g->head[y * g->width + x];
+    g->next[claim]   = *head;
+    *head            = (unsigned char)(claim + 1);
+    g->held[claim]   = true;
+    g->claimX[claim] = (short)x;
+    g->claimY[claim] = (short)y;
+}
+
+void FieldGridPlace(FieldGrid *g, int handle, int x, int y,
+                    bool stepping, int tx, int ty)
+{
+    if (handle < 0 || handle >= FIELD_GRID_MAX_HANDLES) return;
+    Claim(g, handle * 2,     true,     x,  y);
+    Claim(g, handle * 2 + 1, stepping, tx, ty);
+}
+
+void FieldGridRemove(FieldGrid *g, int handle)
+{
+    if (handle < 0 || handle >= FIELD_GRID_MAX_HANDLES) return;
+    Unlink(g, handle * 2);
+    Unlink(g, handle * 2 + 1);
+}
+
+int FieldGridFirst(const FieldGrid *g, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= g->width || y >= g->height) return -1;
+    return g->head[y * g->width + x] - 1;
+}
+
+int FieldGridNext(const FieldGrid *g, int claim)
+{
+    return g->next[claim] - 1;
+}
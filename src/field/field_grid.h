@@ -0,0 +1,49 @@
+#ifndef FIELD_GRID_H
+#define FIELD_GRID_H
+
+#include <stdbool.h>
+#include "tilemap.h"
+
+//----------------------------------------------------------------------------------
+// FieldGrid - uniform tile-resolution spatial index for field entities. Each
+// entity is a small integer handle (field.c assigns them: player, NPCs,
+// enemies, objects) with up to two claims: the tile it stands on and, while
+// mid-step, the tile it is stepping into. Every tile keeps an intrusive list
+// of the claims on it, so "who is on (x, y)" is a head read plus a walk over
+// the one or two entries actually there, whatever the entity count.
+//
+// The grid only knows tiles. field.c re-syncs an entity after anything that
+// can start or commit a step, and filters `active` at query time.
+//----------------------------------------------------------------------------------
+
+#define FIELD_GRID_MAX_HANDLES 64
+#define FIELD_GRID_CLAIMS      (FIELD_GRID_MAX_HANDLES * 2)
+
+// A claim id packs the handle and which of its two tiles it is.
+#define FIELD_GRID_HANDLE(claim)   ((claim) >> 1)
+#define FIELD_GRID_STEPPING(claim) (((claim) & 1) != 0)
+
+typedef struct FieldGrid {
+    int           width, height;
+    unsigned char head[MAP_MAX_W * MAP_MAX_H];  // 1 + first claim on the tile, 0 = none
+    unsigned char next[FIELD_GRID_CLAIMS];      // 1 + next claim on the same tile
+    bool          held[FIELD_GRID_CLAIMS];
+    short         claimX[FIELD_GRID_CLAIMS], claimY[FIELD_GRID_CLAIMS];
+} FieldGrid;
+
+// Empties the grid and sizes it to a width x height map. A zeroed FieldGrid
+// is already a valid empty grid of size 0.
+void FieldGridReset(FieldGrid *g, int width, int height);
+
+// Puts `handle` on (x, y), plus (tx, ty) when stepping. Unchanged claims are
+// left alone, so calling this every frame for a still entity is cheap.
+void FieldGridPlace(FieldGrid *g, int handle, int x, int y,
+                    bool stepping, int tx, int ty);
+void FieldGridRemove(FieldGrid *g, int handle);
+
+// Claims on (x, y): FieldGridFirst returns a claim id or -1; FieldGridNext
+// walks the rest of that tile's list. Order within a tile is unspecified.
+int  FieldGridFirst(const FieldGrid *g, int x, int y);
+int  FieldGridNext(const FieldGrid *g, int claim);
+
+#endif // FIELD_GRID_H
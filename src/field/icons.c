@@ -3,6 +3,7 @@
 #include "../data/move_defs.h"
 #include "../data/armor_defs.h"
 #include "../render/paper_harbor.h"
+#include "../render/sprite_atlas.h"
 #include <math.h>
 
 // ----------------------------------------------------------------------------
@@ -15,6 +16,14 @@ static inline void IconCenter(Rectangle r, float *cx, float *cy) {
     *cy = r.y + r.height * 0.5f;
 }
 
+// Faded ink for secondary strokes (rings, striations, spiral arcs). Real
+// alpha, so the strokes stay translucent over whatever plate the caller puts
+// behind the icon; the atlas bakes keep that alpha intact (sprite_atlas.c).
+static Color InkFade(int alpha)
+{
+    return (Color){ gPH.ink.r, gPH.ink.g, gPH.ink.b, (unsigned char)alpha };
+}
+
 // Draw a simple horizontal fish silhouette: oval body + triangle tail + eye.
 // `len` is body length in pixels; tail adds ~25%. Used for the food icons.
 static void DrawFishSilhouette(float cx, float cy, float len,
@@ -45,7 +54,10 @@ static void DrawFishSilhouette(float cx, float cy, float len,
 // Items
 // ----------------------------------------------------------------------------
 
-void DrawItemIcon(Rectangle r, int itemId)
+// The Draw*Glyph functions below do the actual drawing; the public Draw*Icon
+// entry points at the bottom blit them from the sprite atlas.
+
+static void DrawItemGlyph(Rectangle r, int itemId)
 {
     float cx, cy; IconCenter(r, &cx, &cy);
     float size = (r.width < r.height ? r.width : r.height);
@@ -110,7 +122,7 @@ void DrawItemIcon(Rectangle r, int itemId)
                 DrawCircleLines((int)(cx - size * 0.06f + i * size * 0.04f),
                                 (int)(cy - size * 0.02f),
                                 size * k,
-                                (Color){gPH.ink.r, gPH.ink.g, gPH.ink.b, 130});
+                                InkFade(130));
             }
         } break;
 
@@ -127,7 +139,7 @@ void DrawItemIcon(Rectangle r, int itemId)
 // Moves (weapons + specials)
 // ----------------------------------------------------------------------------
 
-void DrawMoveIcon(Rectangle r, int moveId)
+static void DrawMoveGlyph(Rectangle r, int moveId)
 {
     float cx, cy; IconCenter(r, &cx, &cy);
     float size = (r.width < r.height ? r.width : r.height);
@@ -142,8 +154,7 @@ void DrawMoveIcon(Rectangle r, int moveId)
             DrawCircleLines((int)cx, (int)cy, size * 0.22f, gPH.ink);
             for (int i = 0; i < 3; i++) {
                 DrawCircleLines((int)cx, (int)cy, size * (0.28f + i * 0.07f),
-                                (Color){gPH.ink.r, gPH.ink.g, gPH.ink.b,
-                                        (unsigned char)(160 - i * 50)});
+                                InkFade(160 - i * 50));
             }
         } break;
 
@@ -181,8 +192,7 @@ void DrawMoveIcon(Rectangle r, int moveId)
                 float t = 0.25f + i * 0.18f;
                 Vector2 pa = { cx - size * 0.20f * t, cy + size * (0.15f - i * 0.05f) };
                 Vector2 pb = { cx + size * 0.22f * t, cy + size * (0.18f - i * 0.05f) };
-                DrawLineEx(pa, pb, 1.4f,
-                           (Color){gPH.ink.r, gPH.ink.g, gPH.ink.b, 140});
+                DrawLineEx(pa, pb, 1.4f, InkFade(140));
             }
             // Outline edges — wobble lines for the hand-drawn look
             PHWobbleLine(a, b, 0.6f, 1.4f, gPH.ink, 0xC101);
@@ -216,8 +226,7 @@ void DrawMoveIcon(Rectangle r, int moveId)
             for (int i = 0; i < 3; i++) {
                 DrawCircleLines((int)(cx + size * 0.04f), (int)cy,
                                 size * (0.14f + i * 0.08f),
-                                (Color){gPH.ink.r, gPH.ink.g, gPH.ink.b,
-                                        (unsigned char)(200 - i * 60)});
+                                InkFade(200 - i * 60));
             }
         } break;
 
@@ -270,7 +279,7 @@ void DrawMoveIcon(Rectangle r, int moveId)
 // Armor
 // ----------------------------------------------------------------------------
 
-void DrawArmorIcon(Rectangle r, int armorId)
+static void DrawArmorGlyph(Rectangle r, int armorId)
 {
     float cx, cy; IconCenter(r, &cx, &cy);
     float size = (r.width < r.height ? r.width : r.height);
@@ -310,3 +319,51 @@ void DrawArmorIcon(Rectangle r, int armorId)
         } break;
     }
 }
+
+// ----------------------------------------------------------------------------
+// Atlas entry points
+// ----------------------------------------------------------------------------
+
+// Every glyph is laid out around the centre of r at min(w, h), so icons are
+// baked as that centred square: one bake serves every caller's rect shape.
+static Rectangle IconSquare(Rectangle r)
+{
+    float cx, cy; IconCenter(r, &cx, &cy);
+    float size = (r.width < r.height ? r.width : r.height);
+    return (Rectangle){ cx - size * 0.5f, cy - size * 0.5f, size, size };
+}
+
+// SpriteBakeFn adapters — the bake fn doubles as the icon kind in the
+// atlas key, the id as the variant.
+static void BakeItemGlyph(int id, int dir, int frame, float alpha, bool flash, Rectangle r)
+{
+    (void)dir; (void)frame; (void)alpha; (void)flash;
+    DrawItemGlyph(r, id);
+}
+
+static void BakeMoveGlyph(int id, int dir, int frame, float alpha, bool flash, Rectangle r)
+{
+    (void)dir; (void)frame; (void)alpha; (void)flash;
+    DrawMoveGlyph(r, id);
+}
+
+static void BakeArmorGlyph(int id, int dir, int frame, float alpha, bool flash, Rectangle r)
+{
+    (void)dir; (void)frame; (void)alpha; (void)flash;
+    DrawArmorGlyph(r, id);
+}
+
+void DrawItemIcon(Rectangle r, int itemId)
+{
+    SpriteAtlasDraw(BakeItemGlyph, itemId, 0, 0, IconSquare(r), 1.0f, false);
+}
+
+void DrawMoveIcon(Rectangle r, int moveId)
+{
+    SpriteAtlasDraw(BakeMoveGlyph, moveId, 0, 0, IconSquare(r), 1.0f, false);
+}
+
+void DrawArmorIcon(Rectangle r, int armorId)
+{
+    SpriteAtlasDraw(BakeArmorGlyph, armorId, 0, 0, IconSquare(r), 1.0f, false);
+}
@@ -5,8 +5,9 @@
 
 // Procedural item / move / armor icons. Each draws into the supplied rect
 // using rounded primitives (circles, ellipses, polygons, wobble lines)
-// consistent with the rest of the Paper Harbor visual language. No atlas,
-// no pixel art — every glyph is computed at draw time.
+// consistent with the rest of the Paper Harbor visual language. No pixel
+// art — each (kind, id, size) glyph is drawn procedurally once, baked into
+// the sprite atlas on first use, and blitted as one textured quad after.
 //
 // The rect is the *icon area*; callers typically draw a tile plate behind
 // it and compose name / qty / dur overlays on top.
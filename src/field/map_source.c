@@ -1,5 +1,6 @@
 #include "map_source.h"
 #include "map_dungeon_proc.h"
+#include "../systems/trace.h"
 
 void BuildHarborFloor1(MapBuildContext *ctx);
 void BuildHarborFloor6(MapBuildContext *ctx);
@@ -8,6 +9,7 @@ void BuildOverworldHub(MapBuildContext *ctx);
 
 void MapBuild(MapId id, int floor, MapBuildContext *ctx, unsigned seed)
 {
+    TraceBegin("MapBuild");
     switch (id) {
         case MAP_OVERWORLD_HUB:
             BuildOverworldHub(ctx);
@@ -28,4 +30,5 @@ void MapBuild(MapId id, int floor, MapBuildContext *ctx, unsigned seed)
             BuildOverworldHub(ctx);
             break;
     }
+    TraceEnd();
 }
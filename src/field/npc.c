@@ -1,6 +1,7 @@
 #include "npc.h"
 #include "enemy.h"
 #include "../render/paper_harbor.h"
+#include "../render/sprite_atlas.h"
 #include "../screen_layout.h"
 #include <string.h>
 #include <math.h>
@@ -288,6 +289,25 @@ static void DrawSeal(int px, int py, int sz, int dir)
     }
 }
 
+// SpriteBakeFn for the village cast: variant is the NpcType. NPCs never
+// fade or flash, so alpha/flash are ignored.
+static void DrawNpcSprite(int type, int dir, int frame, float alpha,
+                          bool flash, Rectangle r)
+{
+    (void)frame; (void)alpha; (void)flash;
+    int px = (int)r.x, py = (int)r.y, sz = (int)r.height;
+    switch ((NpcType)type) {
+        case NPC_PENGUIN_ELDER:    DrawPenguinElder(px, py, sz, dir);    break;
+        case NPC_PENGUIN_VILLAGER: DrawPenguinVillager(px, py, sz, dir); break;
+        case NPC_SEAL:          DrawSeal(px, py, sz, dir);         break;
+        case NPC_KEEPER:        DrawKeeper(px, py, sz, dir);       break;
+        case NPC_FOOD_BANK:     DrawFoodBank(px, py, sz, dir);     break;
+        case NPC_SCRIBE:        DrawScribe(px, py, sz, dir);       break;
+        case NPC_SALVAGER:      DrawSalvager(px, py, sz, dir);     break;
+        case NPC_BLACKSMITH:    DrawBlacksmith(px, py, sz, dir);   break;
+    }
+}
+
 void NpcDraw(const Npc *n, Camera2D cam)
 {
     (void)cam; // drawing happens inside BeginMode2D
@@ -312,16 +332,9 @@ void NpcDraw(const Npc *n, Camera2D cam)
     DrawEllipse((int)shCx, (int)shY, sz * 0.30f, sz * 0.09f,
                 (Color){gPH.ink.r, gPH.ink.g, gPH.ink.b, 90});
 
-    switch (n->type) {
-        case NPC_PENGUIN_ELDER:    DrawPenguinElder(px, py, sz, n->dir);    break;
-        case NPC_PENGUIN_VILLAGER: DrawPenguinVillager(px, py, sz, n->dir); break;
-        case NPC_SEAL:          DrawSeal(px, py, sz, n->dir);         break;
-        case NPC_KEEPER:        DrawKeeper(px, py, sz, n->dir);       break;
-        case NPC_FOOD_BANK:     DrawFoodBank(px, py, sz, n->dir);     break;
-        case NPC_SCRIBE:        DrawScribe(px, py, sz, n->dir);       break;
-        case NPC_SALVAGER:      DrawSalvager(px, py, sz, n->dir);     break;
-        case NPC_BLACKSMITH:    DrawBlacksmith(px, py, sz, n->dir);   break;
-    }
+    SpriteAtlasDraw(DrawNpcSprite, (int)n->type, n->dir, 0,
+                    (Rectangle){ (float)px, (float)py, (float)sz, (float)sz },
+                    1.0f, false);
 }
 
 void NpcDrawCaptiveOverlay(const Npc *n)
@@ -1,6 +1,8 @@
 #include "player.h"
 #include "field.h"
 #include "../render/paper_harbor.h"
+#include "../render/sprite_atlas.h"
+#include "../systems/replay.h"
 #include "../systems/touch_input.h"
 #include <math.h>
 
@@ -129,7 +131,7 @@ void PlayerUpdate(Player *p, const TileMap *m, const struct FieldState *f)
 // Rounded procedural Jan — same visual language as DrawPenguinElder and
 // DrawSeal (rounded rectangles, circles, triangles; no pixel-art, no hard
 // outlines). Facing direction drives eye-pupil offset + beak rotation +
-// foot step; no atlas needed.
+// foot step. PlayerDraw blits it from the sprite atlas, one bake per pose.
 static void DrawJanRounded(float px, float py, float sz, int dir, int frame)
 {
     const Color black  = gPH.inkDark;
@@ -217,6 +219,14 @@ static void DrawJanRounded(float px, float py, float sz, int dir, int frame)
                   (int)footW, (int)footH, orange);
 }
 
+// SpriteBakeFn wrapper: one baked pose per (dir, walk frame).
+static void DrawJanBake(int variant, int dir, int frame, float alpha,
+                        bool flash, Rectangle r)
+{
+    (void)variant; (void)alpha; (void)flash;
+    DrawJanRounded(r.x, r.y, r.height, dir, frame);
+}
+
 void PlayerDraw(const Player *p)
 {
     int tilePixels = TILE_SIZE * TILE_SCALE;
@@ -256,7 +266,8 @@ void PlayerDraw(const Player *p)
                     sz * 0.30f, sz * 0.09f, (Color){gPH.ink.r, gPH.ink.g, gPH.ink.b, 90});
     }
 
-    DrawJanRounded(px, py, sz, p->dir, p->animFrame);
+    SpriteAtlasDraw(DrawJanBake, 0, p->dir, p->animFrame,
+                    (Rectangle){ px, py, sz, sz }, 1.0f, false);
 
     // Swimming: water line over the legs + two animated wake arcs.
     if (p->onWater) {
@@ -0,0 +1,38 @@
+#include "tile_los.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Fill every bit of source tile (ax, ay): bit (dy + r) * (2r + 1) + (dx + r).
+static void FillSource(TileLosCache *c, const TileMap *m, int ax, int ay)
+{
+    int r = c->radius, side = 2 * r + 1;
+    uint64_t *words = c->bits[ay * m->width + ax];
+    memset(words, 0, sizeof(c->bits[0]));
+    for (int dy = -r; dy <= r; dy++) {
+        for (int dx = -r; dx <= r; dx++) {
+            if (!c->walk(m, ax, ay, ax + dx, ay + dy)) continue;
+            int bit = (dy + r) * side + (dx + r);
+            words[bit >> 6] |= (uint64_t)1 << (bit & 63);
+        }
+    }
+    c->filled[ay * m->width + ax] = true;
+}
+
+bool TileLosCacheTest(TileLosCache *c, const TileMap *m, int ax, int ay, int bx, int by)
+{
+    int dx = bx - ax, dy = by - ay;
+    if (abs(dx) > c->radius || abs(dy) > c->radius ||
+        ax < 0 || ay < 0 || ax >= m->width || ay >= m->height)
+        return c->walk(m, ax, ay, bx, by);
+
+    if (c->map != m || c->revision != m->revision) {
+        memset(c->filled, 0, sizeof(c->filled));
+        c->map      = m;
+        c->revision = m->revision;
+    }
+    if (!c->filled[ay * m->width + ax]) FillSource(c, m, ax, ay);
+
+    int r   = c->radius;
+    int bit = (dy + r) * (2 * r + 1) + (dx + r);
+    return (c->bits[ay * m->width + ax][bit >> 6] >> (bit & 63)) & 1;
+}
@@ -0,0 +1,40 @@
+#ifndef TILE_LOS_H
+#define TILE_LOS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tilemap.h"
+
+//----------------------------------------------------------------------------------
+// TileLosCache - memoised line of sight around each tile. Maps don't change
+// during a fight, and barely at all otherwise, yet the battle range checks and
+// the field aggro pull ask the same short sightlines over and over. A cache
+// holds, per source tile, one bit for every tile within `radius` (Chebyshev)
+// saying whether `walk` found the line clear. A source tile's bits are filled
+// by its first query; any edit to the map (TileMap.revision) drops them all.
+// Queries beyond the radius just run `walk`.
+//
+// Each LOS rule keeps its own cache (Bresenham for battle ranged reach, the
+// strict voxel walk for field aggro), usually as a file-scope static.
+//----------------------------------------------------------------------------------
+
+#define TILE_LOS_MAX_RADIUS 5
+#define TILE_LOS_WORDS      2   // (2 * TILE_LOS_MAX_RADIUS + 1)^2 bits
+
+typedef bool (*TileLosWalk)(const TileMap *m, int ax, int ay, int bx, int by);
+
+typedef struct TileLosCache {
+    int            radius;      // <= TILE_LOS_MAX_RADIUS
+    TileLosWalk    walk;
+    const TileMap *map;         // map + revision the bits below describe
+    unsigned       revision;
+    bool           filled[MAP_MAX_W * MAP_MAX_H];
+    uint64_t       bits[MAP_MAX_W * MAP_MAX_H][TILE_LOS_WORDS];
+} TileLosCache;
+
+#define TILE_LOS_CACHE(r, fn) { .radius = (r), .walk = (fn) }
+
+// Same answer as c->walk(m, ax, ay, bx, by).
+bool TileLosCacheTest(TileLosCache *c, const TileMap *m, int ax, int ay, int bx, int by);
+
+#endif // TILE_LOS_H
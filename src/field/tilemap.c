@@ -1,5 +1,7 @@
 #include "tilemap.h"
 #include "../render/paper_harbor.h"
+#include "../systems/profiler.h"
+#include "../screen_layout.h"
 #include <string.h>
 #include <math.h>
 
@@ -17,6 +19,71 @@ static const unsigned char TILE_DEFAULT_FLAGS[TILE_COUNT] = {
     TILE_FLAG_WALKABLE,                  // GRASS
 };
 
+// Baked static layer. Nothing in the tile passes animates, yet redrawing them
+// costs a few thousand primitives a frame (every ink edge is a chain of
+// DrawLineEx segments). Instead the map is cut into TILE_CHUNK-square chunks,
+// each baked into a render texture and blitted until an edit stamps it dirty.
+// Only a small pool of chunk textures exists; chunks that scroll away are
+// recycled least-recently-drawn first, so memory stays flat on big floors.
+// Module-static like paper_harbor's grain texture: TileMapDraw only gets a
+// const map, and only one map is ever on screen.
+#define TILE_CHUNK_PAD    4   // px baked past each chunk edge for ink overhang
+#define TILE_CHUNK_MARGIN 3   // tiles past the view that prefetch looks ahead
+
+// Tiles TileMapDraw covers across a view of `px` (a partial tile at each end
+// plus its one-tile pad either side), and the most chunks `t` tiles can touch.
+#define TILE_VIEW_TILES(px)     (((px) + TILE_SIZE * TILE_SCALE - 1) / (TILE_SIZE * TILE_SCALE) + 2)
+#define TILE_CHUNKS_SPANNED(t)  (((t) + TILE_CHUNK - 2) / TILE_CHUNK + 1)
+
+// Resident chunk textures: every chunk the logical view can touch plus the
+// prefetch ring around it (3x3 at 800x450), so a chunk coming into view was
+// normally baked frames earlier and never evicts one still on screen.
+#define TILE_CHUNK_POOL \
+    (TILE_CHUNKS_SPANNED(TILE_VIEW_TILES(SCREEN_W) + 2 * TILE_CHUNK_MARGIN) * \
+     TILE_CHUNKS_SPANNED(TILE_VIEW_TILES(SCREEN_H) + 2 * TILE_CHUNK_MARGIN))
+
+// Bytes of chunk textures, like PH_PANEL_BUDGET. A slot is ~2.3 MB at 1x and
+// ~9.2 MB at 2x: the whole pool fits up to ~1.75x, and at the 2x cap six
+// slots still cover the 3x2 chunks on screen. Above ~1.75x the prefetch
+// ring is what gives way.
+#define TILE_CHUNK_BUDGET ((size_t)64 << 20)
+
+typedef struct TileChunkSlot {
+    RenderTexture2D rt;
+    int             cx, cy;      // chunk held, -1 when free
+    unsigned        stamp;       // chunkRevision the pixels reflect
+    unsigned        lastUsed;    // gTileChunkFrame of the last blit
+} TileChunkSlot;
+
+// Global edit counter stamped into TileMap.chunkRevision. Never reused, so a
+// freshly initialised map can't match a slot baked from the previous one.
+static unsigned      gTileMapRevision = 0;
+
+static TileChunkSlot gTileChunks[TILE_CHUNK_POOL];
+static float         gTileChunkScale = 0.0f;
+static int           gTileChunkSlots = TILE_CHUNK_POOL;   // slots the budget allows at this scale
+static unsigned      gTileChunkFrame = 0;
+
+// Stamp the chunk holding (x, y) plus any neighbour whose bake includes it.
+// Each chunk bakes a one-tile ring of its neighbours so ink crossing the
+// seam lands in its pad — a tile on a chunk border lives in both bakes.
+static void TileMapTouch(TileMap *m, int x, int y)
+{
+    unsigned stamp = ++gTileMapRevision;
+    m->revision = stamp;
+    int cx = x / TILE_CHUNK, cy = y / TILE_CHUNK;
+    int lx = x % TILE_CHUNK, ly = y % TILE_CHUNK;
+    int dx0 = (lx == 0) ? -1 : 0, dx1 = (lx == TILE_CHUNK - 1) ? 1 : 0;
+    int dy0 = (ly == 0) ? -1 : 0, dy1 = (ly == TILE_CHUNK - 1) ? 1 : 0;
+    for (int dy = dy0; dy <= dy1; dy++) {
+        for (int dx = dx0; dx <= dx1; dx++) {
+            int nx = cx + dx, ny = cy + dy;
+            if (nx < 0 || nx >= TILE_CHUNK_COLS || ny < 0 || ny >= TILE_CHUNK_ROWS) continue;
+            m->chunkRevision[ny * TILE_CHUNK_COLS + nx] = stamp;
+        }
+    }
+}
+
 // Two tiles count as the same "region" if they should NOT get an ink edge
 // drawn between them. Ocean and shallow share a region — the visual split
 // happens through the shallow's lighter ripples, not a hard border.
@@ -58,6 +125,9 @@ void TileMapInit(TileMap *m, int width, int height, const char *name)
         m->tiles[i] = TILE_OCEAN;
         m->flags[i] = TILE_DEFAULT_FLAGS[TILE_OCEAN];
     }
+    unsigned stamp = ++gTileMapRevision;
+    for (int i = 0; i < TILE_CHUNK_ROWS * TILE_CHUNK_COLS; i++) m->chunkRevision[i] = stamp;
+    m->revision = stamp;
 }
 
 void TileMapSetTile(TileMap *m, int x, int y, int tileId)
@@ -66,18 +136,23 @@ void TileMapSetTile(TileMap *m, int x, int y, int tileId)
     if (tileId < 0 || tileId >= TILE_COUNT) return;
     m->tiles[y * m->width + x] = tileId;
     m->flags[y * m->width + x] = TILE_DEFAULT_FLAGS[tileId];
+    TileMapTouch(m, x, y);
 }
 
 void TileMapAddFlag(TileMap *m, int x, int y, unsigned char flag)
 {
     if (x < 0 || x >= m->width || y < 0 || y >= m->height) return;
     m->flags[y * m->width + x] |= flag;
+    // Flags don't change the art today, but gates like the F6 gangplank are
+    // expected to get a visual — keep the bake honest for when they do.
+    TileMapTouch(m, x, y);
 }
 
 void TileMapClearFlag(TileMap *m, int x, int y, unsigned char flag)
 {
     if (x < 0 || x >= m->width || y < 0 || y >= m->height) return;
     m->flags[y * m->width + x] &= (unsigned char)~flag;
+    TileMapTouch(m, x, y);
 }
 
 int TileMapGetTile(const TileMap *m, int x, int y)
@@ -128,7 +203,9 @@ static void DrawTileOrnament(int tileId, float tx, float ty, float tp, int col,
     }
     case TILE_SHALLOW: {
         // Lighter, more broken wavelets so shallow reads as ocean-but-bright.
-        Color crest = (Color){0xCC, 0xE6, 0xDE, 230};
+        // Pre-blended over gPH.water (was {CC,E6,DE} @ 230): a translucent
+        // stroke would also lower the alpha of the baked section texture.
+        Color crest = (Color){0xC6, 0xE2, 0xDE, 255};
         float wy = ty + tp * 0.5f + PHHash01(col, row, 14) * 4.0f;
         DrawLineEx((Vector2){tx + tp * 0.2f, wy},
                    (Vector2){tx + tp * 0.5f, wy}, 2.0f, crest);
@@ -184,27 +261,13 @@ static void DrawTileOrnament(int tileId, float tx, float ty, float tp, int col,
     }
 }
 
-void TileMapDraw(const TileMap *m, Camera2D cam)
+// The three static passes over tiles [firstCol, lastCol) x [firstRow, lastRow),
+// in world coordinates. Caller owns the 2D mode.
+static void DrawTilePasses(const TileMap *m, int firstCol, int firstRow,
+                           int lastCol, int lastRow)
 {
-    float screenW = (float)GetScreenWidth();
-    float screenH = (float)GetScreenHeight();
     float tilePixels = (float)(TILE_SIZE * TILE_SCALE);
 
-    Vector2 topLeft = GetScreenToWorld2D((Vector2){0, 0}, cam);
-    // lastCol/lastRow derived from the bottom-right of the viewport so that
-    // camera clamping doesn't drop a column off the right edge. +1 pads a
-    // partial tile at the edge.
-    int firstCol = (int)(topLeft.x / tilePixels) - 1;
-    int firstRow = (int)(topLeft.y / tilePixels) - 1;
-    int lastCol  = (int)((topLeft.x + screenW) / tilePixels) + 1;
-    int lastRow  = (int)((topLeft.y + screenH) / tilePixels) + 1;
-    if (firstCol < 0) firstCol = 0;
-    if (firstRow < 0) firstRow = 0;
-    if (lastCol  > m->width)  lastCol  = m->width;
-    if (lastRow  > m->height) lastRow  = m->height;
-
-    BeginMode2D(cam);
-
     // Pass 1: flat fills.
     for (int row = firstRow; row < lastRow; row++) {
         for (int col = firstCol; col < lastCol; col++) {
@@ -263,12 +326,227 @@ void TileMapDraw(const TileMap *m, Camera2D cam)
                              1.5f, 2.0f, gPH.ink, seedBase + 4);
         }
     }
+}
+
+static void TileChunksRelease(void)
+{
+    for (int i = 0; i < TILE_CHUNK_POOL; i++) {
+        if (gTileChunks[i].rt.id != 0) UnloadRenderTexture(gTileChunks[i].rt);
+        gTileChunks[i] = (TileChunkSlot){ .cx = -1, .cy = -1 };
+    }
+}
+
+// Side of a slot texture in device pixels.
+static int TileChunkSide(float scale)
+{
+    return (int)((TILE_CHUNK * TILE_SIZE * TILE_SCALE + 2 * TILE_CHUNK_PAD) * scale);
+}
 
+static TileChunkSlot *TileChunkFind(int cx, int cy)
+{
+    for (int i = 0; i < gTileChunkSlots; i++) {
+        if (gTileChunks[i].rt.id != 0 && gTileChunks[i].cx == cx && gTileChunks[i].cy == cy)
+            return &gTileChunks[i];
+    }
+    return NULL;
+}
+
+// An empty slot, else the least recently drawn one that isn't on screen this
+// frame and doesn't hold a chunk inside the keep window (chunk coords,
+// inclusive). NULL when nothing qualifies.
+static TileChunkSlot *TileChunkVictim(int keepX0, int keepY0, int keepX1, int keepY1)
+{
+    TileChunkSlot *best = NULL;
+    for (int i = 0; i < gTileChunkSlots; i++) {
+        TileChunkSlot *sl = &gTileChunks[i];
+        if (sl->rt.id == 0) return sl;
+        if (sl->lastUsed == gTileChunkFrame) continue;
+        if (sl->cx >= keepX0 && sl->cx <= keepX1 && sl->cy >= keepY0 && sl->cy <= keepY1) continue;
+        if (!best || sl->lastUsed < best->lastUsed) best = sl;
+    }
+    return best;
+}
+
+// Bake chunk (cx, cy) into `sl` at `scale` device pixels per world pixel.
+// Every slot texture is full chunk size so slots recycle without GPU
+// reallocation; edge chunks just use the top-left of theirs. The ring of
+// neighbour tiles is drawn too, so seam ink (and the neighbour's own
+// right/bottom ink) lands in the pad exactly as the neighbouring chunk
+// bakes it — adjacent blits overlap pixel-identically.
+static bool TileChunkBake(TileChunkSlot *sl, const TileMap *m, int cx, int cy, float scale)
+{
+    int tp = TILE_SIZE * TILE_SCALE;
+    if (sl->rt.id == 0) {
+        int side = TileChunkSide(scale);
+        sl->rt = LoadRenderTexture(side, side);
+        if (sl->rt.id == 0) return false;
+        SetTextureFilter(sl->rt.texture, TEXTURE_FILTER_BILINEAR);
+    }
+    int col0 = cx * TILE_CHUNK, row0 = cy * TILE_CHUNK;
+    int col1 = col0 + TILE_CHUNK, row1 = row0 + TILE_CHUNK;
+    if (col1 > m->width)  col1 = m->width;
+    if (row1 > m->height) row1 = m->height;
+
+    Camera2D bake = {
+        .offset   = { TILE_CHUNK_PAD * scale, TILE_CHUNK_PAD * scale },
+        .target   = { (float)(col0 * tp), (float)(row0 * tp) },
+        .rotation = 0.0f,
+        .zoom     = scale,
+    };
+    int c0 = col0 > 0 ? col0 - 1 : 0, r0 = row0 > 0 ? row0 - 1 : 0;
+    int c1 = col1 < m->width  ? col1 + 1 : col1;
+    int r1 = row1 < m->height ? row1 + 1 : row1;
+
+    BeginTextureMode(sl->rt);
+    ClearBackground(BLANK);
+    BeginMode2D(bake);
+    DrawTilePasses(m, c0, r0, c1, r1);
+    EndMode2D();
+    EndTextureMode();
+
+    sl->cx    = cx;
+    sl->cy    = cy;
+    sl->stamp = m->chunkRevision[cy * TILE_CHUNK_COLS + cx];
+    return true;
+}
+
+// Resident, up-to-date slot for chunk (cx, cy), re-baking in place when the
+// chunk is dirty or recycling a victim when it isn't resident.
+static TileChunkSlot *TileChunkAcquire(const TileMap *m, int cx, int cy, float scale)
+{
+    unsigned want = m->chunkRevision[cy * TILE_CHUNK_COLS + cx];
+    TileChunkSlot *sl = TileChunkFind(cx, cy);
+    if (sl && sl->stamp == want) return sl;
+    if (!sl) sl = TileChunkVictim(0, 0, -1, -1);
+    if (!sl || !TileChunkBake(sl, m, cx, cy, scale)) return NULL;
+    return sl;
+}
+
+void TileMapDraw(const TileMap *m, Camera2D cam)
+{
+    float screenW = (float)GetScreenWidth();
+    float screenH = (float)GetScreenHeight();
+    float tilePixels = (float)(TILE_SIZE * TILE_SCALE);
+
+    Vector2 topLeft = GetScreenToWorld2D((Vector2){0, 0}, cam);
+    // lastCol/lastRow derived from the bottom-right of the viewport so that
+    // camera clamping doesn't drop a column off the right edge. +1 pads a
+    // partial tile at the edge.
+    int firstCol = (int)(topLeft.x / tilePixels) - 1;
+    int firstRow = (int)(topLeft.y / tilePixels) - 1;
+    int lastCol  = (int)((topLeft.x + screenW) / tilePixels) + 1;
+    int lastRow  = (int)((topLeft.y + screenH) / tilePixels) + 1;
+    if (firstCol < 0) firstCol = 0;
+    if (firstRow < 0) firstRow = 0;
+    if (lastCol  > m->width)  lastCol  = m->width;
+    if (lastRow  > m->height) lastRow  = m->height;
+    if (firstCol >= lastCol || firstRow >= lastRow) return;
+
+    // Bake at the backbuffer's pixel density so ink stays as crisp as the
+    // direct draw on retina / phone screens. Capped at 2x to bound texture
+    // memory; a density change (window moved, rotated) drops the pool and
+    // re-fits it to TILE_CHUNK_BUDGET.
+    float scale = (float)GetRenderWidth() / screenW;
+    if (scale < 1.0f) scale = 1.0f;
+    if (scale > 2.0f) scale = 2.0f;
+    if (scale != gTileChunkScale) {
+        TileChunksRelease();
+        gTileChunkScale = scale;
+        size_t side  = (size_t)TileChunkSide(scale);
+        size_t slots = TILE_CHUNK_BUDGET / (side * side * 4);
+        if (slots < 1) slots = 1;
+        if (slots > TILE_CHUNK_POOL) slots = TILE_CHUNK_POOL;
+        gTileChunkSlots = (int)slots;
+    }
+    gTileChunkFrame++;
+
+    int cx0 = firstCol / TILE_CHUNK, cx1 = (lastCol - 1) / TILE_CHUNK;
+    int cy0 = firstRow / TILE_CHUNK, cy1 = (lastRow - 1) / TILE_CHUNK;
+    // A view bigger than the budget allows (or a failed texture load) leaves
+    // some chunks without a slot; those are drawn directly instead.
+    TileChunkSlot *visible[TILE_CHUNK_POOL];
+    int nVisible = 0;
+    int directCx[TILE_CHUNK_COLS * TILE_CHUNK_ROWS], directCy[TILE_CHUNK_COLS * TILE_CHUNK_ROWS];
+    int nDirect = 0;
+    ProfBegin(PROF_TILE_BAKE);
+    for (int cy = cy0; cy <= cy1; cy++) {
+        for (int cx = cx0; cx <= cx1; cx++) {
+            TileChunkSlot *sl = nVisible < gTileChunkSlots ? TileChunkAcquire(m, cx, cy, scale) : NULL;
+            if (!sl) {
+                directCx[nDirect] = cx;
+                directCy[nDirect] = cy;
+                nDirect++;
+                continue;
+            }
+            sl->lastUsed = gTileChunkFrame;
+            visible[nVisible++] = sl;
+        }
+    }
+    ProfEnd(PROF_TILE_BAKE);
+
+    // Prefetch: when the viewport is within TILE_CHUNK_MARGIN tiles of a
+    // chunk it can't see yet, bake that chunk now — at most one per frame — so
+    // walking across a seam doesn't pay for the bake on the frame it comes
+    // into view. Prefetches never evict each other (keep window), so a
+    // viewport near a map corner can't thrash the pool re-baking the same
+    // neighbours.
+    const int margin = TILE_CHUNK_MARGIN;
+    int maxCx = (m->width - 1) / TILE_CHUNK, maxCy = (m->height - 1) / TILE_CHUNK;
+    int pcx0 = (firstCol - margin) / TILE_CHUNK, pcx1 = (lastCol - 1 + margin) / TILE_CHUNK;
+    int pcy0 = (firstRow - margin) / TILE_CHUNK, pcy1 = (lastRow - 1 + margin) / TILE_CHUNK;
+    if (pcx0 < 0) pcx0 = 0;
+    if (pcy0 < 0) pcy0 = 0;
+    if (pcx1 > maxCx) pcx1 = maxCx;
+    if (pcy1 > maxCy) pcy1 = maxCy;
+    bool prefetched = false;
+    ProfBegin(PROF_TILE_PREFETCH);
+    for (int cy = pcy0; cy <= pcy1 && !prefetched; cy++) {
+        for (int cx = pcx0; cx <= pcx1 && !prefetched; cx++) {
+            if (cx >= cx0 && cx <= cx1 && cy >= cy0 && cy <= cy1) continue;
+            TileChunkSlot *sl = TileChunkFind(cx, cy);
+            if (sl && sl->stamp == m->chunkRevision[cy * TILE_CHUNK_COLS + cx]) continue;
+            if (!sl) sl = TileChunkVictim(pcx0, pcy0, pcx1, pcy1);
+            if (!sl) continue;
+            prefetched = TileChunkBake(sl, m, cx, cy, scale);
+            if (prefetched) sl->lastUsed = gTileChunkFrame;
+        }
+    }
+    ProfEnd(PROF_TILE_PREFETCH);
+
+    ProfBegin(PROF_TILE_BLIT);
+    BeginMode2D(cam);
+    int tp = (int)tilePixels;
+    for (int i = 0; i < nVisible; i++) {
+        const TileChunkSlot *sl = visible[i];
+        int col0 = sl->cx * TILE_CHUNK, row0 = sl->cy * TILE_CHUNK;
+        int cols = (m->width  - col0 < TILE_CHUNK) ? m->width  - col0 : TILE_CHUNK;
+        int rows = (m->height - row0 < TILE_CHUNK) ? m->height - row0 : TILE_CHUNK;
+        float w = (cols * tp + 2 * TILE_CHUNK_PAD) * scale;
+        float h = (rows * tp + 2 * TILE_CHUNK_PAD) * scale;
+        // Render targets read bottom-up, so the baked top-left corner is the
+        // last `h` rows of the texture, sampled with a negative height.
+        float texH = (float)sl->rt.texture.height;
+        Rectangle src = { 0.0f, texH - h, w, -h };
+        Rectangle dst = {
+            (float)(col0 * tp - TILE_CHUNK_PAD),
+            (float)(row0 * tp - TILE_CHUNK_PAD),
+            w / scale, h / scale,
+        };
+        DrawTexturePro(sl->rt.texture, src, dst, (Vector2){0, 0}, 0.0f, WHITE);
+    }
+    for (int i = 0; i < nDirect; i++) {
+        int col0 = directCx[i] * TILE_CHUNK, row0 = directCy[i] * TILE_CHUNK;
+        int col1 = col0 + TILE_CHUNK < m->width  ? col0 + TILE_CHUNK : m->width;
+        int row1 = row0 + TILE_CHUNK < m->height ? row0 + TILE_CHUNK : m->height;
+        DrawTilePasses(m, col0, row0, col1, row1);
+    }
     EndMode2D();
+    ProfEnd(PROF_TILE_BLIT);
 }
 
 void TileMapUnload(TileMap *m)
 {
+    TileChunksRelease();
     if (m->tileset.id != 0) {
         UnloadTexture(m->tileset);
         m->tileset.id = 0;
@@ -13,6 +13,12 @@
 #define MAP_MAX_W   64
 #define MAP_MAX_H   64
 
+// TileMapDraw bakes the map in square chunks of TILE_CHUNK tiles; edits
+// stamp only the chunks whose baked pixels they change.
+#define TILE_CHUNK       16
+#define TILE_CHUNK_COLS  ((MAP_MAX_W + TILE_CHUNK - 1) / TILE_CHUNK)
+#define TILE_CHUNK_ROWS  ((MAP_MAX_H + TILE_CHUNK - 1) / TILE_CHUNK)
+
 // Tile IDs for the procedural tileset
 #define TILE_OCEAN   0
 #define TILE_SHALLOW 1
@@ -36,6 +42,8 @@ typedef struct TileMap {
     unsigned char flags[MAP_MAX_W * MAP_MAX_H]; // per-tile flags
     Texture2D     tileset;
     char          name[64];
+    unsigned      chunkRevision[TILE_CHUNK_ROWS * TILE_CHUNK_COLS]; // per-chunk edit stamp; keys the baked draw cache
+    unsigned      revision;            // stamp of the latest edit anywhere; keys tile-derived caches (tile_los.h)
 } TileMap;
 
 // Build a procedural tileset texture (TILE_COUNT tiles wide, 1 tile tall)
@@ -53,7 +61,12 @@ int  TileMapGetTile(const TileMap *m, int x, int y);
 unsigned char TileMapGetFlags(const TileMap *m, int x, int y);
 bool TileMapIsSolid(const TileMap *m, int x, int y);
 bool TileMapIsWater(const TileMap *m, int x, int y);
+// Draws the visible part of the map. The static layer (fills, ornaments,
+// ink edges) is baked per chunk into a small pool of render textures kept
+// around the viewport; an edit re-bakes only the chunks it touched, so a
+// steady-state frame is a handful of texture blits.
 void TileMapDraw(const TileMap *m, Camera2D cam);
+// Releases the tileset and the baked draw cache.
 void TileMapUnload(TileMap *m);
 
 #endif // TILEMAP_H
@@ -15,8 +15,21 @@
 #include "raylib.h"
 #include "screens.h"    // NOTE: Declares global (extern) variables and screens functions
 #include "render/paper_harbor.h"
+#include "render/sprite_atlas.h"
+#include "systems/bench_mode.h"
+#include "systems/profiler.h"
+#include "systems/replay.h"
+#include "systems/session_metrics.h"
+#include "systems/soak.h"
+#include "systems/startup_timeline.h"
+#include "systems/touch_input.h"
+#include "systems/trace.h"
 #include "screen_layout.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #if defined(PLATFORM_WEB)
     #include <emscripten/emscripten.h>
 #endif
@@ -57,18 +70,61 @@ static void UpdateDrawFrame(void);          // Update and draw one frame
 //----------------------------------------------------------------------------------
 // Program main entry point
 //----------------------------------------------------------------------------------
-int main(void)
+int main(int argc, char *argv[])
 {
     // Initialization
     //---------------------------------------------------------
+    StartupInit();      // cold-start timeline, reported at the first frame
+
+    // --bench <scenario> [--frames <n>] skips LOGO/TITLE into a canned scene,
+    // runs it unpaced and prints frame-time percentiles (systems/bench_mode.h).
+    // --startup-budget <ms> exits 1 when main-to-first-present runs over.
+    // --soak <minutes> [--soak-seed <n>] [--soak-threshold <pct>] plays that
+    // long unpaced (replay or random-input bot) and exits 1 on memory growth.
+    const char *benchScenario = NULL;
+    int benchFrames = 0;
+    float soakMinutes = 0.0f, soakThreshold = 0.0f;
+    unsigned soakSeed = 1;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--bench") == 0) benchScenario = argv[++i];
+        else if (strcmp(argv[i], "--frames") == 0) benchFrames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--startup-budget") == 0) StartupSetBudget((float)atof(argv[++i]));
+        else if (strcmp(argv[i], "--soak") == 0) soakMinutes = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "--soak-seed") == 0) soakSeed = (unsigned)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--soak-threshold") == 0) soakThreshold = (float)atof(argv[++i]);
+    }
+    if (benchScenario && !BenchModeStart(benchScenario, benchFrames))
+    {
+        fprintf(stderr, "--bench: unknown scenario %s (expected %s)\n", benchScenario,
+                BenchModeScenarioNames());
+        return 1;
+    }
+
+    // DDKP_TRACE=<path> records a Perfetto timeline from the first frame.
+    TraceInit();
+    // DDKP_RECORD=<path> / DDKP_REPLAY=<path> record or play back input.
+    ReplayInit();
+    if (soakMinutes > 0.0f)
+    {
+        if (!ReplayPlaying()) ReplayStartBot(soakSeed);
+        SoakStart(soakMinutes, soakThreshold);
+    }
+    const bool unpaced = ReplayUnpaced() || BenchModeActive();
+
     // VSYNC_HINT blocks the frame loop on display refresh instead of spin-
     // waiting against SetTargetFPS — drops idle CPU from ~17% to ~1-2% on a
     // 2D scene. HIGHDPI lets retina displays render at native pixel density
     // so text stays crisp.
-    SetConfigFlags(FLAG_VSYNC_HINT | FLAG_WINDOW_HIGHDPI);
+    // Fast replays and bench runs go unpaced, so they get neither.
+    SetConfigFlags(unpaced ? FLAG_WINDOW_HIGHDPI : (FLAG_VSYNC_HINT | FLAG_WINDOW_HIGHDPI));
+    StartupBegin("InitWindow");
     InitWindow(screenWidth, screenHeight, "Die Dapper Klein Pikkewyn");
+    StartupEnd();
 
+    StartupBegin("InitAudioDevice");
     InitAudioDevice();      // Initialize audio device
+    StartupEnd();
 
     // Resolve resource paths relative to the executable so `./game` and
     // double-clicking both work. Without this, LoadTexture/LoadFont/LoadSound
@@ -86,28 +142,45 @@ int main(void)
     // Codepoints arg is 0/0 for "default ASCII set" — using a literal 0
     // here instead of NULL because raylib_game.c doesn't pull in <stddef.h>
     // and the Mac (clang) build complains about undeclared NULL.
+    StartupBegin("LoadFontEx 96px + mipmaps");
     font = LoadFontEx("resources/EBGaramond-Bold.ttf", 96, 0, 0);
     GenTextureMipmaps(&font.texture);
     SetTextureFilter(font.texture, TEXTURE_FILTER_TRILINEAR);
+    StartupEnd();
     //music = LoadMusicStream("resources/ambient.ogg"); // TODO: Load music
+    StartupBegin("LoadSound");
     fxCoin = LoadSound("resources/coin.wav");
+    StartupEnd();
 
     // Paper Harbor paper-grain texture. Baked once at the screen's logical
     // resolution; blitted in a single GPU draw at the end of each screen.
+    StartupBegin("PHInit grain bake");
     PHInit(screenWidth, screenHeight);
+    StartupEnd();
 
     // Setup and init first screen
-    currentScreen = TITLE;
-    InitTitleScreen();
+    StartupBegin("InitScreen");
+    if (BenchModeActive())
+    {
+        GameplayRequestBench();
+        currentScreen = GAMEPLAY;
+        InitGameplayScreen();
+    }
+    else
+    {
+        currentScreen = TITLE;
+        InitTitleScreen();
+    }
+    StartupEnd();
 
 #if defined(PLATFORM_WEB)
     emscripten_set_main_loop(UpdateDrawFrame, 60, 1);
 #else
-    SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
+    if (!unpaced) SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
 
     // Main game loop
-    while (!WindowShouldClose())    // Detect window close button or ESC key
+    while (!WindowShouldClose() && !ReplayFinished() && !BenchModeFinished() && !SoakFinished())    // Detect window close button or ESC key
     {
         UpdateDrawFrame();
     }
@@ -115,6 +188,12 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    BenchModeReport();  // frame-time percentiles of a --bench run
+    const bool soakOk = SoakReport();   // memory trends of a --soak run
+    ReplayShutdown();   // writes the recording / prints the playback report
+    TraceShutdown();
+    MetricsWrite();     // session_metrics.json beside savegame.dat
+
     // Unload current screen data before closing
     switch (currentScreen)
     {
@@ -137,7 +216,7 @@ int main(void)
     CloseWindow();          // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
-    return 0;
+    return (StartupWithinBudget() && soakOk) ? 0 : 1;
 }
 
 //----------------------------------------------------------------------------------
@@ -250,6 +329,10 @@ static void DrawTransition(void)
 // Update and draw game frame
 static void UpdateDrawFrame(void)
 {
+    TraceBegin("Frame");
+    ReplayFrameBegin();     // before anything reads input this frame
+    TouchInputUpdate();     // once per frame, before any screen consumes a tap
+
     // Update
     //----------------------------------------------------------------------------------
     //UpdateMusicStream(music);       // NOTE: Music keeps playing between screens
@@ -318,6 +401,11 @@ static void UpdateDrawFrame(void)
         // flash a white bar.
         ClearBackground(gPH.bg);
 
+        // Bake last frame's sprite / panel misses before any screen opens
+        // a Mode2D; every screen uses them, not just the field.
+        SpriteAtlasBakePending();
+        PHBakePending();
+
         switch(currentScreen)
         {
             case LOGO: DrawLogoScreen(); break;
@@ -334,6 +422,19 @@ static void UpdateDrawFrame(void)
 
         //DrawFPS(10, 10);
 
+        // Dev frame profiler (F11 in the field), above everything else.
+        ProfDrawOverlay();
+
+    ProfBegin(PROF_PRESENT);
+    const bool firstFrame = !StartupDone();
+    if (firstFrame) StartupBegin("FirstPresent");
     EndDrawing();
+    if (firstFrame) StartupFinish();    // first interactive frame
+    ProfEnd(PROF_PRESENT);
+    ProfFrameEnd();
+    MetricsFrameEnd(currentScreen);
+    BenchModeFrameEnd();
+    SoakFrameEnd();
+    TraceEnd();
     //----------------------------------------------------------------------------------
 }
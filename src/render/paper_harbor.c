@@ -36,6 +36,67 @@ static Texture2D gPHGrain = {0};
 static int       gPHGrainW = 0;
 static int       gPHGrainH = 0;
 
+// Wobble point cache. The jitter is a pure function of (a, b, jitter, seed)
+// through PHHash01, and the same borders are drawn every frame (panels,
+// HUD frames), so the point lists are kept instead of re-hashed. Direct-
+// mapped, replace on collision — a miss only costs the original compute.
+// Lines longer than PH_WOBBLE_MAX_PTS points (~830 px) bypass the cache.
+#define PH_WOBBLE_CACHE    128
+#define PH_WOBBLE_MAX_PTS  168
+
+typedef struct PHWobbleEntry {
+    Vector2 a, b;
+    float   jitter;
+    int     seed;
+    int     count;                      // 0 = empty slot
+    Vector2 pts[PH_WOBBLE_MAX_PTS];
+} PHWobbleEntry;
+
+// Longest path PHDrawPolyline emits as one strip; also sizes the scratch
+// lists for uncached lines and for PHDrawPanel's closed border loop.
+#define PH_POLY_MAX_PTS    1024
+
+static PHWobbleEntry gPHWobble[PH_WOBBLE_CACHE];
+static Vector2       gPHWobbleScratch[PH_POLY_MAX_PTS];
+static Vector2       gPHPanelLoop[PH_POLY_MAX_PTS];
+static Vector2       gPHStrip[2 * PH_POLY_MAX_PTS + 2];   // two per point + closing pair
+
+// Baked panel borders, keyed by (w, h, seed). Modal panels come from a
+// dozen fixed layouts and are drawn every frame while open, so each gets
+// its border baked into a render texture and the panel costs one fill rect
+// plus one blit. Small LRU table under a byte budget; baking happens in
+// PHBakePending because panels are drawn wherever the caller is (the
+// inventory slides in under a camera transform).
+#define PH_PANEL_CACHE   12
+#define PH_PANEL_PAD     6                    // px baked past the rect for ink overhang
+#define PH_PANEL_BUDGET  ((size_t)24 << 20)   // bytes of baked panel textures
+
+typedef struct PHPanelEntry {
+    int             w, h, seed;
+    RenderTexture2D rt;         // id 0 until baked
+    unsigned        lastUsed;   // gPHFrame of the last draw, 0 = free slot
+    bool            queued;     // seen on consecutive frames, bake next chance
+} PHPanelEntry;
+
+static PHPanelEntry gPHPanels[PH_PANEL_CACHE];
+static size_t       gPHPanelBytes = 0;
+static float        gPHPanelScale = 0.0f;
+static unsigned     gPHFrame = 1;
+
+static size_t PHPanelBytes(const PHPanelEntry *e)
+{
+    return (size_t)e->rt.texture.width * (size_t)e->rt.texture.height * 4;
+}
+
+static void PHPanelsRelease(void)
+{
+    for (int i = 0; i < PH_PANEL_CACHE; i++) {
+        if (gPHPanels[i].rt.id != 0) UnloadRenderTexture(gPHPanels[i].rt);
+    }
+    memset(gPHPanels, 0, sizeof(gPHPanels));
+    gPHPanelBytes = 0;
+}
+
 unsigned static PHHash32(int x, int y, int salt)
 {
     unsigned h = (unsigned)(x * 73856093) ^ (unsigned)(y * 19349663) ^ (unsigned)(salt * 83492791);
@@ -68,6 +129,7 @@ void PHInit(int screenW, int screenH)
 
 void PHUnload(void)
 {
+    PHPanelsRelease();
     if (gPHGrain.id != 0) {
         UnloadTexture(gPHGrain);
         gPHGrain.id = 0;
@@ -75,15 +137,30 @@ void PHUnload(void)
     }
 }
 
-void PHWobbleLine(Vector2 a, Vector2 b, float jitter, float thickness,
-                  Color c, int seed)
+static unsigned PHFloatBits(float f)
+{
+    unsigned u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+// Fills `out` (room for `max` points) with the wobbled path from a to b —
+// the same points the old segment-by-segment PHWobbleLine visited. Returns
+// the point count, or 0 if it doesn't fit.
+static int PHWobbleCompute(Vector2 a, Vector2 b, float jitter, int seed,
+                           Vector2 *out, int max)
 {
     float dx = b.x - a.x, dy = b.y - a.y;
     float len = sqrtf(dx*dx + dy*dy);
-    if (len < 1.0f) { DrawLineEx(a, b, thickness, c); return; }
+    if (len < 1.0f) {
+        if (max < 2) return 0;
+        out[0] = a; out[1] = b;
+        return 2;
+    }
     int segs = (int)(len / 5.0f) + 1;
+    if (segs + 1 > max) return 0;
     float ndx = -dy / len, ndy = dx / len;
-    Vector2 prev = a;
+    out[0] = a;
     for (int i = 1; i <= segs; i++) {
         float t = (float)i / (float)segs;
         float px = a.x + dx * t;
@@ -93,22 +170,264 @@ void PHWobbleLine(Vector2 a, Vector2 b, float jitter, float thickness,
             px += ndx * j;
             py += ndy * j;
         }
-        Vector2 cur = {px, py};
-        DrawLineEx(prev, cur, thickness, c);
-        prev = cur;
+        out[i] = (Vector2){px, py};
     }
+    return segs + 1;
+}
+
+const Vector2 *PHWobblePoints(Vector2 a, Vector2 b, float jitter, int seed, int *count)
+{
+    unsigned h = PHHash32((int)PHFloatBits(a.x) ^ (int)PHFloatBits(b.y),
+                          (int)PHFloatBits(a.y) ^ (int)PHFloatBits(b.x),
+                          seed ^ (int)PHFloatBits(jitter));
+    PHWobbleEntry *e = &gPHWobble[h % PH_WOBBLE_CACHE];
+    if (e->count > 0 && e->seed == seed && e->jitter == jitter
+        && e->a.x == a.x && e->a.y == a.y && e->b.x == b.x && e->b.y == b.y) {
+        *count = e->count;
+        return e->pts;
+    }
+    int n = PHWobbleCompute(a, b, jitter, seed, e->pts, PH_WOBBLE_MAX_PTS);
+    if (n > 0) {
+        e->a = a; e->b = b; e->jitter = jitter; e->seed = seed; e->count = n;
+        *count = n;
+        return e->pts;
+    }
+    // Too long for an entry. Nothing was written, so the slot keeps its path.
+    *count = PHWobbleCompute(a, b, jitter, seed, gPHWobbleScratch, PH_POLY_MAX_PTS);
+    return gPHWobbleScratch;
+}
+
+// Unit left-normal of p→q (matches DrawLineEx's strip orientation). False
+// for a zero-length segment.
+static bool PHSegNormal(Vector2 p, Vector2 q, Vector2 *n)
+{
+    float dx = q.x - p.x, dy = q.y - p.y;
+    float len = sqrtf(dx*dx + dy*dy);
+    if (len < 0.0001f) return false;
+    *n = (Vector2){ -dy / len, dx / len };
+    return true;
+}
+
+void PHDrawPolyline(const Vector2 *pts, int count, float thickness, Color c, bool closed)
+{
+    if (count < 2) return;
+    // Oversized paths draw in strip-sized pieces; only the piece joints
+    // lose their miter.
+    if (count > PH_POLY_MAX_PTS) {
+        for (int start = 0; start < count - 1; start += PH_POLY_MAX_PTS - 1) {
+            int n = count - start;
+            if (n > PH_POLY_MAX_PTS) n = PH_POLY_MAX_PTS;
+            PHDrawPolyline(pts + start, n, thickness, c, false);
+        }
+        if (closed) DrawLineEx(pts[count - 1], pts[0], thickness, c);
+        return;
+    }
+
+    float half = thickness * 0.5f;
+    int nv = 0;
+    for (int i = 0; i < count; i++) {
+        // Neighbours along the path; open ends reuse their only segment.
+        int ip = (i > 0) ? i - 1 : (closed ? count - 1 : -1);
+        int in = (i < count - 1) ? i + 1 : (closed ? 0 : -1);
+        Vector2 n0 = {0}, n1 = {0};
+        bool h0 = (ip >= 0) && PHSegNormal(pts[ip], pts[i], &n0);
+        bool h1 = (in >= 0) && PHSegNormal(pts[i], pts[in], &n1);
+        if (!h0) n0 = n1;
+        if (!h1) n1 = n0;
+        if (!h0 && !h1) continue;
+
+        // Miter: bisector of the two normals, stretched so the strip keeps
+        // its thickness through the bend. Clamped for near-reversals.
+        Vector2 m = { n0.x + n1.x, n0.y + n1.y };
+        float ml = sqrtf(m.x*m.x + m.y*m.y);
+        if (ml < 0.0001f) m = n0;
+        else { m.x /= ml; m.y /= ml; }
+        float cosHalf = m.x * n0.x + m.y * n0.y;
+        if (cosHalf < 0.25f) cosHalf = 0.25f;
+        float s = half / cosHalf;
+
+        gPHStrip[nv++] = (Vector2){ pts[i].x - m.x * s, pts[i].y - m.y * s };
+        gPHStrip[nv++] = (Vector2){ pts[i].x + m.x * s, pts[i].y + m.y * s };
+    }
+    if (closed && nv >= 2) {
+        gPHStrip[nv]     = gPHStrip[0];
+        gPHStrip[nv + 1] = gPHStrip[1];
+        nv += 2;
+    }
+    DrawTriangleStrip(gPHStrip, nv, c);
+}
+
+void PHWobbleLine(Vector2 a, Vector2 b, float jitter, float thickness,
+                  Color c, int seed)
+{
+    int n = 0;
+    const Vector2 *pts = PHWobblePoints(a, b, jitter, seed, &n);
+    if (n == 0) { DrawLineEx(a, b, thickness, c); return; }   // absurdly long line
+    PHDrawPolyline(pts, n, thickness, c, false);
+}
+
+// The ink border of a w x h panel whose top-left sits at (x, y). The wobble
+// is hashed in panel-local coordinates, so a panel keeps its exact border
+// wherever it's drawn — a slide-in doesn't make the ink boil, and a baked
+// copy matches the live draw pixel for pixel.
+static void PHPanelBorder(float x, float y, float w, float h, int seed)
+{
+    // The four wobbled sides chained into one closed loop, so the corners
+    // get a proper miter instead of two overlapping butt ends. Each side
+    // keeps its own seed.
+    const Vector2 corner[5] = { {0, 0}, {w, 0}, {w, h}, {0, h}, {0, 0} };
+    int total = 0;
+    for (int side = 0; side < 4; side++) {
+        int n = 0;
+        const Vector2 *pts = PHWobblePoints(corner[side], corner[side + 1], 2.0f,
+                                            seed + 1 + side, &n);
+        // Drop each side's last point: it's the next side's first.
+        if (n < 2 || total + n - 1 > PH_POLY_MAX_PTS) {
+            total = -1;
+            break;
+        }
+        for (int i = 0; i < n - 1; i++)
+            gPHPanelLoop[total + i] = (Vector2){ pts[i].x + x, pts[i].y + y };
+        total += n - 1;
+    }
+    if (total > 0) {
+        PHDrawPolyline(gPHPanelLoop, total, 2.0f, gPH.ink, true);
+    } else {
+        for (int side = 0; side < 4; side++) {
+            Vector2 a = { corner[side].x + x, corner[side].y + y };
+            Vector2 b = { corner[side + 1].x + x, corner[side + 1].y + y };
+            PHWobbleLine(a, b, 2.0f, 2.0f, gPH.ink, seed + 1 + side);
+        }
+    }
+}
+
+static PHPanelEntry *PHPanelFind(int w, int h, int seed)
+{
+    for (int i = 0; i < PH_PANEL_CACHE; i++) {
+        PHPanelEntry *e = &gPHPanels[i];
+        if (e->w == w && e->h == h && e->seed == seed && e->lastUsed != 0) return e;
+    }
+    return NULL;
+}
+
+static void PHPanelDrop(PHPanelEntry *e)
+{
+    if (e->rt.id != 0) {
+        UnloadRenderTexture(e->rt);
+        gPHPanelBytes -= PHPanelBytes(e);
+    }
+    memset(e, 0, sizeof(*e));
+}
+
+// Free slot, else the least recently drawn one not drawn this frame.
+static PHPanelEntry *PHPanelVictim(void)
+{
+    PHPanelEntry *v = NULL;
+    for (int i = 0; i < PH_PANEL_CACHE; i++) {
+        PHPanelEntry *e = &gPHPanels[i];
+        if (e->lastUsed == 0) return e;
+        if (e->lastUsed == gPHFrame) continue;
+        if (!v || e->lastUsed < v->lastUsed) v = e;
+    }
+    return v;
 }
 
 void PHDrawPanel(Rectangle rect, int seed)
 {
     DrawRectangleRec(rect, gPH.panel);
-    float x0 = rect.x, y0 = rect.y;
-    float x1 = rect.x + rect.width;
-    float y1 = rect.y + rect.height;
-    PHWobbleLine((Vector2){x0, y0}, (Vector2){x1, y0}, 2.0f, 2.0f, gPH.ink, seed + 1);
-    PHWobbleLine((Vector2){x1, y0}, (Vector2){x1, y1}, 2.0f, 2.0f, gPH.ink, seed + 2);
-    PHWobbleLine((Vector2){x1, y1}, (Vector2){x0, y1}, 2.0f, 2.0f, gPH.ink, seed + 3);
-    PHWobbleLine((Vector2){x0, y1}, (Vector2){x0, y0}, 2.0f, 2.0f, gPH.ink, seed + 4);
+
+    // Only whole-pixel sizes are cached; a panel mid-resize animation
+    // would just churn textures.
+    int w = (int)rect.width, h = (int)rect.height;
+    if ((float)w != rect.width || (float)h != rect.height || w <= 0 || h <= 0) {
+        PHPanelBorder(rect.x, rect.y, rect.width, rect.height, seed);
+        return;
+    }
+
+    PHPanelEntry *e = PHPanelFind(w, h, seed);
+    if (e && e->rt.id != 0) {
+        e->lastUsed = gPHFrame;
+        float pad = (float)PH_PANEL_PAD;
+        Rectangle src = { 0, 0, (float)e->rt.texture.width, -(float)e->rt.texture.height };
+        Rectangle dst = { rect.x - pad, rect.y - pad, (float)w + 2.0f * pad, (float)h + 2.0f * pad };
+        DrawTexturePro(e->rt.texture, src, dst, (Vector2){0, 0}, 0.0f, WHITE);
+        return;
+    }
+
+    // Miss. Bake only once the same panel shows up on a second frame, so
+    // one-off toasts and transient layouts never allocate a texture.
+    if (!e) {
+        e = PHPanelVictim();
+        if (e) {
+            PHPanelDrop(e);
+            e->w = w; e->h = h; e->seed = seed;
+            e->lastUsed = gPHFrame;
+        }
+    } else if (e->lastUsed != gPHFrame) {
+        if (e->lastUsed + 1 == gPHFrame) e->queued = true;
+        e->lastUsed = gPHFrame;
+    }
+    PHPanelBorder(rect.x, rect.y, rect.width, rect.height, seed);
+}
+
+void PHBakePending(void)
+{
+    gPHFrame++;
+
+    // Same density rule as the tile chunks: bake at backbuffer resolution,
+    // capped at 2x; a change drops every bake.
+    float scale = (float)GetRenderWidth() / (float)GetScreenWidth();
+    if (scale < 1.0f) scale = 1.0f;
+    if (scale > 2.0f) scale = 2.0f;
+    if (scale != gPHPanelScale) {
+        PHPanelsRelease();
+        gPHPanelScale = scale;
+    }
+
+    for (int i = 0; i < PH_PANEL_CACHE; i++) {
+        PHPanelEntry *e = &gPHPanels[i];
+        if (!e->queued) continue;
+        e->queued = false;
+
+        int texW = (int)ceilf((float)(e->w + 2 * PH_PANEL_PAD) * scale);
+        int texH = (int)ceilf((float)(e->h + 2 * PH_PANEL_PAD) * scale);
+        size_t bytes = (size_t)texW * (size_t)texH * 4;
+        // Make room under the byte budget, oldest bakes first. Panels drawn
+        // last frame are still on screen; if they alone fill the budget the
+        // newcomer stays live rather than thrashing bakes every frame.
+        while (gPHPanelBytes + bytes > PH_PANEL_BUDGET) {
+            PHPanelEntry *old = NULL;
+            for (int j = 0; j < PH_PANEL_CACHE; j++) {
+                PHPanelEntry *o = &gPHPanels[j];
+                if (o == e || o->rt.id == 0 || o->lastUsed + 1 >= gPHFrame) continue;
+                if (!old || o->lastUsed < old->lastUsed) old = o;
+            }
+            if (!old) break;
+            PHPanelDrop(old);
+        }
+        if (gPHPanelBytes + bytes > PH_PANEL_BUDGET) continue;
+
+        e->rt = LoadRenderTexture(texW, texH);
+        if (e->rt.id == 0) continue;
+        SetTextureFilter(e->rt.texture, TEXTURE_FILTER_BILINEAR);
+        gPHPanelBytes += bytes;
+
+        // Only the border is baked; the fill stays a live rect in
+        // PHDrawPanel because the panel colour is translucent and a
+        // translucent bake over cleared texels comes out lighter under GL.
+        Camera2D cam = {
+            .offset   = { PH_PANEL_PAD * scale, PH_PANEL_PAD * scale },
+            .target   = { 0.0f, 0.0f },
+            .rotation = 0.0f,
+            .zoom     = scale,
+        };
+        BeginTextureMode(e->rt);
+        ClearBackground((Color){gPH.ink.r, gPH.ink.g, gPH.ink.b, 0});
+        BeginMode2D(cam);
+        PHPanelBorder(0.0f, 0.0f, (float)e->w, (float)e->h, e->seed);
+        EndMode2D();
+        EndTextureMode();
+    }
 }
 
 void PHDrawPaperGrain(Rectangle rect)
@@ -2,6 +2,7 @@
 #define PAPER_HARBOR_H
 
 #include "raylib.h"
+#include <stdbool.h>
 
 // Paper Harbor is the game's committed visual direction (see style_preview.c
 // for the A/B research that picked it): flat pastel fills for tiles, ragged
@@ -41,14 +42,29 @@ void PHUnload(void);
 // Wobbled segmented line. Perturbs every ~5px along the path perpendicular
 // to it by up to `jitter` pixels. `seed` keeps the wobble stable across
 // frames — pick a unique int per call site so two nearby borders don't
-// jitter in lockstep.
+// jitter in lockstep. Drawn as one mitered strip (see PHDrawPolyline).
 void PHWobbleLine(Vector2 a, Vector2 b, float jitter, float thickness,
                   Color c, int seed);
 
+// The wobbled point list PHWobbleLine draws, endpoints included. Served
+// from a small cache keyed by (a, b, jitter, seed); the pointer is valid
+// until the next call. *count receives the number of points.
+const Vector2 *PHWobblePoints(Vector2 a, Vector2 b, float jitter, int seed, int *count);
+
+// Thick polyline as a single triangle strip with mitered joins, so joints
+// neither gap nor overdraw (no doubled alpha with translucent ink).
+// `closed` joins the last point back to the first.
+void PHDrawPolyline(const Vector2 *pts, int count, float thickness, Color c, bool closed);
+
 // Parchment panel with a ragged ink border, drawn at the given rect in
-// screen space. `seed` stabilizes the border wobble per call site.
+// screen space. `seed` stabilizes the border wobble per call site. The
+// border is baked per (w, h, seed) once a panel stays up for two frames.
 void PHDrawPanel(Rectangle rect, int seed);
 
+// Bakes panels queued by PHDrawPanel. Call once per frame outside any
+// BeginMode2D / BeginTextureMode, before the frame's UI draws.
+void PHBakePending(void);
+
 // Blits the baked paper-grain texture over the given rect. Typically called
 // once at the end of a screen's Draw with rect = {0, 0, screenW, screenH}.
 // Costs a single GPU draw.
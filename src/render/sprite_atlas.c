@@ -0,0 +1,265 @@
+#include "sprite_atlas.h"
+#include "paper_harbor.h"
+#ifndef RAYLIB_SHIM_H
+#include "rlgl.h"
+#endif
+#include <string.h>
+#include <math.h>
+
+// Characters are the busiest thing on screen after the tiles: every sailor,
+// penguin and Jan is a dozen rounded rects, ellipses and wobbled ink lines,
+// redrawn each frame even though only a handful of poses exist. Each pose is
+// baked once into a cell on a shared page and drawn as one textured quad.
+//
+// Cells are shelf-packed onto SPRITE_ATLAS_PAGE-square render textures.
+// When every page is full, or a new pose turns up with SPRITE_ATLAS_MAX
+// entries already live, the whole atlas is forgotten and re-filled lazily;
+// the working set (a floor's sailors, the village cast and the icons of
+// whichever menus are open) is around a hundred cells, so that only happens
+// if sizes churn.
+#define SPRITE_ATLAS_PAGE     1024
+#define SPRITE_ATLAS_PAGES    6
+#define SPRITE_ATLAS_SLOTS    256   // hash table size, power of two
+#define SPRITE_ATLAS_MAX      192   // live entries, keeps probes short
+#define SPRITE_ATLAS_QUEUE    64    // bakes pending for the next safe point
+#define SPRITE_ATLAS_GUTTER   2     // texels between cells against bilinear bleed
+
+typedef enum {
+    SPRITE_EMPTY = 0,
+    SPRITE_PENDING,
+    SPRITE_BAKED,
+} SpriteState;
+
+typedef struct SpriteEntry {
+    SpriteBakeFn fn;
+    int          variant, dir, frame;
+    int          w, h;          // sprite rect size in world px
+    bool         flash;
+    SpriteState  state;
+    int          page;
+    Rectangle    cell;          // texel rect on the page, top-down
+    float        pad;           // world px baked around the sprite rect
+} SpriteEntry;
+
+typedef struct SpritePage {
+    RenderTexture2D rt;
+    int             x, y, shelfH;   // shelf packer cursor
+    bool            clear;          // stale pixels from before a reset
+} SpritePage;
+
+static SpriteEntry gSprites[SPRITE_ATLAS_SLOTS];
+static int         gSpriteCount = 0;
+static int         gSpriteQueue[SPRITE_ATLAS_QUEUE];
+static int         gSpriteQueued = 0;
+static bool        gSpriteFull = false;   // a miss found the entry cap
+static SpritePage  gSpritePages[SPRITE_ATLAS_PAGES];
+static int         gSpritePageCount = 0;
+static float       gSpriteScale = 0.0f;
+
+static unsigned SpriteHash(SpriteBakeFn fn, int variant, int dir, int frame,
+                           int w, int h, bool flash)
+{
+    (void)fn;  // function pointers can't portably be hashed; compared on probe
+    unsigned k = (unsigned)variant * 2654435761u;
+    k ^= (unsigned)(dir + 4 * frame) * 40503u;
+    k ^= (unsigned)w * 73856093u ^ (unsigned)h * 19349663u;
+    k ^= flash ? 0x9E3779B9u : 0u;
+    k ^= k >> 15;
+    return k & (SPRITE_ATLAS_SLOTS - 1);
+}
+
+// Slot holding the key, or the empty slot where it would go. -1 when the
+// table is full and the key is absent.
+static int SpriteFind(SpriteBakeFn fn, int variant, int dir, int frame,
+                      int w, int h, bool flash)
+{
+    unsigned i = SpriteHash(fn, variant, dir, frame, w, h, flash);
+    for (int n = 0; n < SPRITE_ATLAS_SLOTS; n++, i = (i + 1) & (SPRITE_ATLAS_SLOTS - 1)) {
+        const SpriteEntry *e = &gSprites[i];
+        if (e->state == SPRITE_EMPTY) return (int)i;
+        if (e->fn == fn && e->variant == variant && e->dir == dir &&
+            e->frame == frame && e->w == w && e->h == h && e->flash == flash)
+            return (int)i;
+    }
+    return -1;
+}
+
+void SpriteAtlasReset(void)
+{
+    memset(gSprites, 0, sizeof(gSprites));
+    gSpriteCount  = 0;
+    gSpriteQueued = 0;
+    gSpriteFull   = false;
+    for (int p = 0; p < gSpritePageCount; p++) {
+        gSpritePages[p].x = gSpritePages[p].y = gSpritePages[p].shelfH = 0;
+        gSpritePages[p].clear = true;
+    }
+}
+
+void SpriteAtlasUnload(void)
+{
+    for (int p = 0; p < gSpritePageCount; p++) {
+        if (gSpritePages[p].rt.id != 0) UnloadRenderTexture(gSpritePages[p].rt);
+    }
+    memset(gSpritePages, 0, sizeof(gSpritePages));
+    gSpritePageCount = 0;
+    SpriteAtlasReset();
+}
+
+// Reserve a cw x ch texel cell, opening a new page when the current ones are
+// full. Returns the page index, or -1 when the atlas is out of room.
+static int SpritePack(int cw, int ch, Rectangle *cell)
+{
+    if (cw > SPRITE_ATLAS_PAGE || ch > SPRITE_ATLAS_PAGE) return -1;
+    for (int p = 0; p <= gSpritePageCount && p < SPRITE_ATLAS_PAGES; p++) {
+        SpritePage *pg = &gSpritePages[p];
+        if (p == gSpritePageCount) {
+            pg->rt = LoadRenderTexture(SPRITE_ATLAS_PAGE, SPRITE_ATLAS_PAGE);
+            if (pg->rt.id == 0) return -1;
+            SetTextureFilter(pg->rt.texture, TEXTURE_FILTER_BILINEAR);
+            pg->x = pg->y = pg->shelfH = 0;
+            pg->clear = true;
+            gSpritePageCount++;
+        }
+        if (pg->x + cw > SPRITE_ATLAS_PAGE) {
+            pg->x = 0;
+            pg->y += pg->shelfH + SPRITE_ATLAS_GUTTER;
+            pg->shelfH = 0;
+        }
+        if (pg->y + ch > SPRITE_ATLAS_PAGE) continue;
+        *cell = (Rectangle){ (float)pg->x, (float)pg->y, (float)cw, (float)ch };
+        pg->x += cw + SPRITE_ATLAS_GUTTER;
+        if (ch > pg->shelfH) pg->shelfH = ch;
+        return p;
+    }
+    return -1;
+}
+
+void SpriteAtlasDraw(SpriteBakeFn bake, int variant, int dir, int frame,
+                     Rectangle r, float alpha, bool flash)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+    int w = (int)lroundf(r.width), h = (int)lroundf(r.height);
+    int slot = (w > 0 && h > 0) ? SpriteFind(bake, variant, dir, frame, w, h, flash) : -1;
+
+    if (slot >= 0 && gSprites[slot].state == SPRITE_BAKED) {
+        const SpriteEntry *e = &gSprites[slot];
+        const SpritePage *pg = &gSpritePages[e->page];
+        // Stretch by the sub-pixel difference between r and the baked size
+        // (a 1.3x boss is 62.4 px wide, baked at 62).
+        float sx = r.width / (float)w, sy = r.height / (float)h;
+        Rectangle dst = { r.x - e->pad * sx, r.y - e->pad * sy,
+                          e->cell.width  / gSpriteScale * sx,
+                          e->cell.height / gSpriteScale * sy };
+        // Render textures are stored bottom-up: flip the source rect.
+        Rectangle src = { e->cell.x,
+                          (float)pg->rt.texture.height - e->cell.y - e->cell.height,
+                          e->cell.width, -e->cell.height };
+        DrawTexturePro(pg->rt.texture, src, dst, (Vector2){0, 0}, 0.0f,
+                       (Color){255, 255, 255, (unsigned char)(alpha * 255.0f)});
+        return;
+    }
+
+    if (slot >= 0 && gSprites[slot].state == SPRITE_EMPTY &&
+        gSpriteQueued < SPRITE_ATLAS_QUEUE) {
+        if (gSpriteCount >= SPRITE_ATLAS_MAX) {
+            // Let the next safe point start over rather than drawing this
+            // pose procedurally for the rest of the session.
+            gSpriteFull = true;
+        } else {
+            SpriteEntry *e = &gSprites[slot];
+            *e = (SpriteEntry){ .fn = bake, .variant = variant, .dir = dir,
+                                .frame = frame, .w = w, .h = h, .flash = flash,
+                                .state = SPRITE_PENDING };
+            gSpriteCount++;
+            gSpriteQueue[gSpriteQueued++] = slot;
+        }
+    }
+    bake(variant, dir, frame, alpha, flash, r);
+}
+
+// Cells start transparent, so translucent strokes (faded ink on icons) must
+// leave their own alpha behind: dstA = srcA + dstA * (1 - srcA). SDL's
+// BLEND mode already does that; raylib's default BLEND_ALPHA runs the alpha
+// channel through the colour factors too and stores srcA^2, which is why
+// faded strokes came out too faint once baked.
+static void SpriteBakeBlendBegin(void)
+{
+#ifndef RAYLIB_SHIM_H
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+#endif
+}
+
+static void SpriteBakeBlendEnd(void)
+{
+#ifndef RAYLIB_SHIM_H
+    EndBlendMode();
+#endif
+}
+
+void SpriteAtlasBakePending(void)
+{
+    // Bake at the backbuffer's pixel density, like the tile chunks, so the
+    // blit is 1:1 on retina screens. A density change forgets every bake
+    // (and this frame's queue; those sprites simply miss again next frame).
+    float scale = (float)GetRenderWidth() / (float)GetScreenWidth();
+    if (scale < 1.0f) scale = 1.0f;
+    if (scale > 2.0f) scale = 2.0f;
+    if (scale != gSpriteScale) {
+        SpriteAtlasReset();
+        gSpriteScale = scale;
+    }
+    // Out of entries: forget the atlas, as when the pages fill. The poses
+    // still on screen miss next frame and re-queue.
+    if (gSpriteFull) SpriteAtlasReset();
+    if (gSpriteQueued == 0) return;
+
+    int open = -1;
+    for (int q = 0; q < gSpriteQueued; q++) {
+        SpriteEntry *e = &gSprites[gSpriteQueue[q]];
+        // Room for overhang past r: the seal's tail, hat brims, beaks.
+        e->pad = ceilf((float)(e->w > e->h ? e->w : e->h) * 0.3f) + 2.0f;
+        int cw = (int)ceilf(((float)e->w + 2.0f * e->pad) * scale);
+        int ch = (int)ceilf(((float)e->h + 2.0f * e->pad) * scale);
+        int page = SpritePack(cw, ch, &e->cell);
+        if (page < 0) {
+            // Out of room. Forget the atlas; what didn't get baked this time
+            // misses again next frame and re-queues into empty pages.
+            if (open >= 0) { SpriteBakeBlendEnd(); EndTextureMode(); }
+            SpriteAtlasReset();
+            return;
+        }
+        e->page = page;
+
+        if (page != open) {
+            if (open >= 0) { SpriteBakeBlendEnd(); EndTextureMode(); }
+            BeginTextureMode(gSpritePages[page].rt);
+            SpriteBakeBlendBegin();
+            open = page;
+            if (gSpritePages[page].clear) {
+                // Transparent ink rather than transparent black: bilinear
+                // edge texels then fade toward the outline colour instead of
+                // picking up a dark halo.
+                ClearBackground((Color){gPH.inkDark.r, gPH.inkDark.g, gPH.inkDark.b, 0});
+                gSpritePages[page].clear = false;
+            }
+        }
+        Camera2D cam = {
+            .offset   = { e->cell.x + e->pad * scale, e->cell.y + e->pad * scale },
+            .target   = { 0.0f, 0.0f },
+            .rotation = 0.0f,
+            .zoom     = scale,
+        };
+        BeginMode2D(cam);
+        e->fn(e->variant, e->dir, e->frame, 1.0f, e->flash,
+              (Rectangle){ 0.0f, 0.0f, (float)e->w, (float)e->h });
+        EndMode2D();
+        e->state = SPRITE_BAKED;
+    }
+    if (open >= 0) { SpriteBakeBlendEnd(); EndTextureMode(); }
+    gSpriteQueued = 0;
+}
@@ -0,0 +1,36 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+// Baked atlas for the procedural characters (sailors, NPC penguins/seal,
+// Jan) and the item / move / armor icons in the menus. Each distinct
+// (draw fn, variant, dir, frame, size, flash) is drawn once into a shared
+// render-texture page and blitted from then on; alpha is applied as the
+// blit tint so fades never re-bake.
+//
+// A bake fn draws one sprite into `r` exactly like the direct draw would.
+// It is called with alpha = 1 for bakes and with the caller's alpha for the
+// procedural fallback used while a bake is still pending.
+typedef void (*SpriteBakeFn)(int variant, int dir, int frame, float alpha,
+                             bool flash, Rectangle r);
+
+// Draws the sprite at `r` (world or screen space, whatever mode is active).
+// A miss queues the bake and draws procedurally this frame: render targets
+// can't be bound inside the caller's BeginMode2D, so baking waits for
+// SpriteAtlasBakePending. Pass frame 0 when the sprite doesn't animate.
+void SpriteAtlasDraw(SpriteBakeFn bake, int variant, int dir, int frame,
+                     Rectangle r, float alpha, bool flash);
+
+// Bakes everything queued since the last call. Call outside any
+// BeginMode2D / BeginTextureMode, before the frame's character draws.
+void SpriteAtlasBakePending(void);
+
+// Forgets every baked sprite (pages are kept and re-filled lazily).
+void SpriteAtlasReset(void);
+
+// Frees the atlas pages. Safe to call when nothing was ever baked.
+void SpriteAtlasUnload(void);
+
+#endif // SPRITE_ATLAS_H
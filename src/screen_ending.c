@@ -25,6 +25,8 @@
 
 #include "raylib.h"
 #include "screens.h"
+#include "systems/replay.h"
+#include "systems/touch_input.h"
 
 //----------------------------------------------------------------------------------
 // Module Variables Definition (local)
@@ -50,7 +52,7 @@ void UpdateEndingScreen(void)
     // TODO: Update ENDING screen variables here!
 
     // Press enter or tap to return to TITLE screen
-    if (IsKeyPressed(KEY_ENTER) || IsGestureDetected(GESTURE_TAP))
+    if (IsKeyPressed(KEY_ENTER) || TouchTapOccurred(NULL))
     {
         finishScreen = 1;
         PlaySound(fxCoin);
@@ -10,6 +10,11 @@
 #include "field/field.h"
 #include "state/game_state.h"
 #include "state/save.h"
+#include "systems/bench_mode.h"
+#include "systems/profiler.h"
+#include "systems/replay.h"
+#include "systems/session_metrics.h"
+#include "systems/trace.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -20,6 +25,7 @@ typedef enum GameplayEntry {
     ENTRY_CONTINUE = 0,  // default: keep existing session
     ENTRY_NEW,
     ENTRY_LOAD,
+    ENTRY_BENCH,         // canned --bench scene, see systems/bench_mode.h
 } GameplayEntry;
 
 static int  finishScreen   = 0;
@@ -34,6 +40,7 @@ void GameplayRequestNewGame(int difficulty) {
     gPendingDifficulty = difficulty;
 }
 void GameplayRequestLoadGame(void) { gEntryMode = ENTRY_LOAD; }
+void GameplayRequestBench(void) { gEntryMode = ENTRY_BENCH; }
 
 // Rescue dialogue — shown after a battle-defeat hub rescue transition.
 #define RESCUE_MSG_PAGES 2
@@ -61,7 +68,11 @@ void InitGameplayScreen(void)
 
     bool loaded = false;
     int  loadX = 0, loadY = 0, loadDir = 0;
-    if (gEntryMode == ENTRY_LOAD) {
+    if (ReplayTakeGameState(&gGameState, &loadX, &loadY, &loadDir)) {
+        // Playback starts from the recorded state whichever button was hit,
+        // so the local save file can't change the run.
+        loaded = true;
+    } else if (gEntryMode == ENTRY_LOAD) {
         loaded = LoadGame(&gGameState, &loadX, &loadY, &loadDir);
     }
     if (!loaded) {
@@ -71,7 +82,10 @@ void InitGameplayScreen(void)
         // path covers fresh runs only.
         gGameState.difficulty = gPendingDifficulty;
     }
+    bool bench = (!loaded && gEntryMode == ENTRY_BENCH);
+    if (bench) BenchScenarioPrepare(&gGameState);
     FieldInit(&gField, &gGameState);
+    if (bench) BenchScenarioEnter(&gField);
 
     // FieldInit spawns the player at the map's default entry. If we just
     // loaded a save, snap them back to the exact tile they saved on.
@@ -91,8 +105,10 @@ void InitGameplayScreen(void)
 
     gInitialized = true;
     gEntryMode   = ENTRY_CONTINUE;
+    ReplayNoteGameState(&gGameState, &gField.player.tileX, &gField.player.tileY,
+                        &gField.player.dir);
 
-    if (!loaded) {
+    if (!loaded && !bench) {
         // First write so a save file exists immediately — the title screen's
         // Load button stays dark until one exists.
         SaveGame(&gGameState, gField.player.tileX, gField.player.tileY,
@@ -104,7 +120,11 @@ void InitGameplayScreen(void)
 // steps on a warp tile, or when field.c flagged a defeat-rescue transition.
 static void ApplyPendingMapTransition(void)
 {
+    // Everything below lands in one frame; the zones show where it goes.
+    TraceBegin("ApplyPendingMapTransition");
+    TraceBegin("FieldUnload");
     FieldUnload(&gField);
+    TraceEnd();
 
     gGameState.currentMapId    = gGameState.pendingMapId;
     gGameState.currentMapSeed  = gGameState.pendingMapSeed;
@@ -114,7 +134,9 @@ static void ApplyPendingMapTransition(void)
     int sdir = gGameState.pendingSpawnDir;
     gGameState.hasPendingMap = false;
 
+    TraceBegin("FieldInit");
     FieldInit(&gField, &gGameState);
+    TraceEnd();
 
     gField.player.tileX         = sx;
     gField.player.tileY         = sy;
@@ -156,16 +178,21 @@ static void ApplyPendingMapTransition(void)
     // transition are all natural "safe point" moments in a turn-based game.
     SaveGame(&gGameState, gField.player.tileX, gField.player.tileY,
              gField.player.dir);
+    TraceEnd();
 }
 
 void UpdateGameplayScreen(void)
 {
+    MetricsSetField(gGameState.currentMapId, gGameState.currentFloor,
+                    gField.mode == FIELD_BATTLE ? (int)gField.battle.state : -1);
     if (gGameState.hasPendingMap) {
         ApplyPendingMapTransition();
         return;
     }
 
+    ProfBegin(PROF_FIELD_UPDATE);
     FieldUpdate(&gField, GetFrameTime());
+    ProfEnd(PROF_FIELD_UPDATE);
 }
 
 void DrawGameplayScreen(void)
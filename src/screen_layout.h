@@ -45,6 +45,10 @@
 //----------------------------------------------------------------------------------
 extern Font font;
 
+// Text time is charged to the frame profiler's PROF_TEXT scope here, since
+// these two shims are where nearly all game text goes through.
+#include "systems/profiler.h"
+
 // SDL3_ttf rasterizes glyphs at the requested point size against a HiDPI
 // backbuffer (the renderer's logical-presentation scale handles upscaling
 // from our 800×450 canvas to the device's physical pixels). At 1.0 the text
@@ -57,13 +61,21 @@ extern Font font;
 
 static inline void DrawTextShim(const char *text, int x, int y, int size, Color color) {
     float s = (float)size * UI_TEXT_SCALE;
+    ProfBegin(PROF_TEXT);
     DrawTextEx(font, text, (Vector2){ (float)x, (float)y }, s, 0.0f, color);
+    ProfEnd(PROF_TEXT);
 }
 static inline int MeasureTextShim(const char *text, int size) {
     float s = (float)size * UI_TEXT_SCALE;
-    return (int)MeasureTextEx(font, text, s, 0.0f).x;
+    ProfBegin(PROF_TEXT);
+    int w = (int)MeasureTextEx(font, text, s, 0.0f).x;
+    ProfEnd(PROF_TEXT);
+    return w;
 }
 #define DrawText    DrawTextShim
 #define MeasureText MeasureTextShim
 
+// Key and frame-time reads route through the input recorder the same way.
+#include "systems/replay.h"
+
 #endif // SCREEN_LAYOUT_H
@@ -27,6 +27,7 @@
 #include "screens.h"
 #include "state/save.h"
 #include "screen_layout.h"
+#include "systems/startup_timeline.h"
 #include "systems/ui_button.h"
 #include "render/paper_harbor.h"
 #include "version.h"
@@ -63,11 +64,13 @@ void InitTitleScreen(void) {
     // Full illustration (logo + subtitle + art) — buttons overlay the bottom.
     // Portrait build gets its own asset so the composition reads correctly in
     // 9:16 without cover-crop chewing off the sides.
+    StartupBegin("Title texture decode");
 #if SCREEN_PORTRAIT
     titleArt = LoadTexture("resources/title-mobile.png");
 #else
     titleArt = LoadTexture("resources/title.png");
 #endif
+    StartupEnd();
 }
 
 // Returns the index of the next *enabled* button stepping by dir (-1 or +1),
@@ -86,6 +86,9 @@ int FinishGameplayScreen(void);
 // default; the player must pick before the run begins.
 void GameplayRequestNewGame(int difficulty);
 void GameplayRequestLoadGame(void);
+// Entry points call this for --bench: the next InitGameplayScreen builds the
+// selected scenario instead (see systems/bench_mode.h) and never saves.
+void GameplayRequestBench(void);
 
 //----------------------------------------------------------------------------------
 // Battle Screen Functions Declaration
@@ -16,9 +16,19 @@
 #include "../screens.h"
 #include "../screen_layout.h"
 #include "../render/paper_harbor.h"
+#include "../render/sprite_atlas.h"
 #include "../systems/touch_input.h"
+#include "../systems/bench_mode.h"
+#include "../systems/profiler.h"
+#include "../systems/replay.h"
+#include "../systems/session_metrics.h"
+#include "../systems/soak.h"
+#include "../systems/startup_timeline.h"
+#include "../systems/trace.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // ---------------------------------------------------------------------------
 // Globals declared `extern` in screens.h / screen_layout.h.
@@ -138,30 +148,127 @@ static void DrawTransition(void) {
 // ---------------------------------------------------------------------------
 
 int main(int argc, char *argv[]) {
-    (void)argc; (void)argv;
-    SetConfigFlags(FLAG_VSYNC_HINT | FLAG_WINDOW_HIGHDPI);
+    StartupInit();
+    // --render-csv <path>     per-frame SDL submission counters
+    //                          (DDKP_RENDER_STATS builds only)
+    // --headless null|soft     no window: drop draws, or render on the CPU
+    // --frames <n>             exit after n frames
+    // --dump-frame <path>      PNG of the last frame (--headless soft)
+    // --record <path>          record input for replay
+    // --replay <path>          play a recording back, as fast as possible
+    //                          (add --realtime for 60 Hz)
+    // --bench <scenario>       straight into a canned scene, unpaced; prints
+    //                          frame-time percentiles after --frames frames
+    // --startup-budget <ms>    fail (exit 1) when main-to-first-present runs
+    //                          over; with --headless null --frames 1 this
+    //                          is the startup benchmark
+    // --soak <minutes>         soak run: that many simulated minutes,
+    //                          unpaced, failing (exit 1) on memory growth;
+    //                          driven by --replay if given, else by the
+    //                          random-input bot (--soak-seed <n>)
+    // --soak-threshold <pct>   growth that fails a soak run (default 10)
+    const char *renderCsv = NULL, *dumpFrame = NULL, *recordPath = NULL, *replayPath = NULL;
+    const char *benchScenario = NULL;
+    float soakMinutes = 0.0f, soakThreshold = 0.0f;
+    unsigned soakSeed = 1;
+    long maxFrames = 0;
+    bool realtime = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--realtime") == 0) { realtime = true; continue; }
+        if (i + 1 >= argc) break;
+        if (strcmp(argv[i], "--render-csv") == 0)      renderCsv = argv[++i];
+        else if (strcmp(argv[i], "--record") == 0)     recordPath = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0)     replayPath = argv[++i];
+        else if (strcmp(argv[i], "--frames") == 0)     maxFrames = strtol(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--dump-frame") == 0) dumpFrame = argv[++i];
+        else if (strcmp(argv[i], "--bench") == 0)      benchScenario = argv[++i];
+        else if (strcmp(argv[i], "--startup-budget") == 0) StartupSetBudget(strtof(argv[++i], NULL));
+        else if (strcmp(argv[i], "--soak") == 0)       soakMinutes = strtof(argv[++i], NULL);
+        else if (strcmp(argv[i], "--soak-seed") == 0)  soakSeed = (unsigned)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--soak-threshold") == 0) soakThreshold = strtof(argv[++i], NULL);
+        else if (strcmp(argv[i], "--headless") == 0) {
+            const char *m = argv[++i];
+            if (strcmp(m, "null") == 0)      SetHeadlessMode(HEADLESS_NULL);
+            else if (strcmp(m, "soft") == 0) SetHeadlessMode(HEADLESS_SOFTWARE);
+            else fprintf(stderr, "--headless: expected null or soft, got %s\n", m);
+        }
+    }
+    const bool headless = GetHeadlessMode() != HEADLESS_OFF;
+
+    // A bench run owns the frame count: --frames is how many it measures.
+    if (benchScenario) {
+        if (!BenchModeStart(benchScenario, (int)maxFrames)) {
+            fprintf(stderr, "--bench: unknown scenario %s (expected %s)\n", benchScenario,
+                    BenchModeScenarioNames());
+            return 1;
+        }
+        maxFrames = 0;
+    }
+
+    if (replayPath && !ReplayStartPlayback(replayPath, realtime))
+        fprintf(stderr, "--replay: could not load %s\n", replayPath);
+    if (recordPath && !ReplayStartRecording(recordPath))
+        fprintf(stderr, "--record: a replay is already running\n");
+    if (soakMinutes > 0.0f) {
+        if (!ReplayPlaying()) ReplayStartBot(soakSeed);
+        SoakStart(soakMinutes, soakThreshold);
+    }
+    ReplayInit();
+    // Headless runs and fast replays go as fast as the CPU allows.
+    const bool unpaced = ReplayPlaying() ? ReplayUnpaced() : (headless || BenchModeActive());
+
+    TraceInit();
+    // The shim's own zones feed the startup timeline while the window comes
+    // up (SDL_Init, TTF_Init, window creation), then go to the trace only.
+    SetRenderTraceHooks(StartupBegin, StartupEnd);
+    SetConfigFlags(unpaced ? FLAG_WINDOW_HIGHDPI : (FLAG_VSYNC_HINT | FLAG_WINDOW_HIGHDPI));
+    StartupBegin("InitWindow");
     InitWindow(SCREEN_W, SCREEN_H, "Die Dapper Klein Pikkewyn (SDL3)");
+    StartupEnd();
+    SetRenderTraceHooks(TraceBegin, TraceEnd);
+
+    if (renderCsv && !SetRenderStatsCsv(renderCsv))
+        fprintf(stderr, "--render-csv: render stats not compiled in, or %s unwritable\n",
+                renderCsv);
+    StartupBegin("InitAudioDevice");
     InitAudioDevice();
+    StartupEnd();
     ChangeDirectory(GetApplicationDirectory());
 
+    StartupBegin("LoadFontEx 96px + mipmaps");
     font = LoadFontEx("resources/EBGaramond-Bold.ttf", 96, 0, 0);
     GenTextureMipmaps(&font.texture);
     SetTextureFilter(font.texture, TEXTURE_FILTER_TRILINEAR);
+    StartupEnd();
+    StartupBegin("LoadSound");
     fxCoin = LoadSound("resources/coin.wav");
+    StartupEnd();
+    StartupBegin("PHInit grain bake");
     PHInit(SCREEN_W, SCREEN_H);
+    StartupEnd();
 
-    // Skip the raylib-style logo splash — go straight to TITLE.
+    // Skip the raylib-style logo splash — go straight to TITLE, or past it
+    // for a bench run.
     currentScreen = TITLE;
+    if (BenchModeActive()) {
+        GameplayRequestBench();
+        currentScreen = GAMEPLAY;
+    }
+    StartupBegin("InitScreen");
     InitScreen(currentScreen);
-    SetTargetFPS(60);
+    StartupEnd();
+    if (!unpaced) SetTargetFPS(60);
 
     bool quitRequested = false;
+    long frames = 0;
     while (!WindowShouldClose() && !quitRequested) {
         // Touch gesture state must tick exactly once per frame, BEFORE any
         // screen tries to consume taps via TouchTapInRect / TouchPressedDir.
         // Previously this was tucked inside FieldUpdate, which left the
         // title/battle/options screens with a frozen gesture state — taps
         // on chunky buttons there did nothing.
+        TraceBegin("Frame");
+        ReplayFrameBegin();
         TouchInputUpdate();
 
         if (!onTransition) {
@@ -197,16 +304,47 @@ int main(int argc, char *argv[]) {
 
         BeginDrawing();
         ClearBackground(gPH.bg);
+        // Bake last frame's sprite / panel misses before any screen opens
+        // a Mode2D; every screen uses them, not just the field.
+        SpriteAtlasBakePending();
+        PHBakePending();
         DrawScreen(currentScreen);
         if (onTransition) DrawTransition();
+        ProfDrawOverlay();
+        // EndDrawing flushes the geometry batch, presents and paces to the
+        // target FPS; the profiler's PRESENT scope is all three.
+        ProfBegin(PROF_PRESENT);
+        const bool firstFrame = !StartupDone();
+        if (firstFrame) StartupBegin("FirstPresent");
         EndDrawing();
+        if (firstFrame) StartupFinish();    // first interactive frame
+        ProfEnd(PROF_PRESENT);
+        ProfFrameEnd();
+        MetricsFrameEnd(currentScreen);
+        BenchModeFrameEnd();
+        SoakFrameEnd();
+        TraceEnd();
+        if (++frames == maxFrames || ReplayFinished() || BenchModeFinished() || SoakFinished())
+            quitRequested = true;
+    }
+
+    if (dumpFrame && !SaveHeadlessFrame(dumpFrame))
+        fprintf(stderr, "--dump-frame: needs --headless soft, or %s unwritable\n", dumpFrame);
+    if (headless) {
+        printf("headless: %ld frames, %llu submissions dropped\n", frames,
+               GetHeadlessSubmissions());
     }
 
+    BenchModeReport();
+    const bool soakOk = SoakReport();
+    ReplayShutdown();
     UnloadScreen(currentScreen);
+    TraceShutdown();
+    MetricsWrite();
     UnloadFont(font);
     UnloadSound(fxCoin);
     PHUnload();
     CloseAudioDevice();
     CloseWindow();
-    return 0;
+    return (StartupWithinBudget() && soakOk) ? 0 : 1;
 }
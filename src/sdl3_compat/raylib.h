@@ -16,6 +16,7 @@
 #define RAYLIB_SHIM_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // Math constants raylib exposes through raylib.h.
@@ -61,11 +62,22 @@ typedef struct Texture2D {
     int mipmaps;
     int format;
     void *_sdl;            // SDL_Texture*
+    int _target;           // 1 = render-target color buffer (see DrawTexturePro)
 } Texture2D;
 
 typedef Texture2D Texture;
-typedef Texture2D RenderTexture2D;
-typedef Texture2D RenderTexture;
+
+// Offscreen render target. Same shape as raylib's RenderTexture (framebuffer
+// id + color texture + depth) so game code that blits `rt.texture` compiles
+// unchanged on both builds. `depth` is never populated — the 2D renderer has
+// no depth buffer.
+typedef struct RenderTexture2D {
+    unsigned int id;
+    Texture2D texture;
+    Texture2D depth;
+} RenderTexture2D;
+
+typedef RenderTexture2D RenderTexture;
 
 // Image is a CPU-side pixel buffer (used by paper_harbor for the paper grain).
 // We mirror raylib's struct shape so existing code compiles; pixel manipulation
@@ -240,6 +252,8 @@ typedef struct Camera2D {
 #define KEY_F8              297
 #define KEY_F9              298
 #define KEY_F10             299
+#define KEY_F11             300
+#define KEY_F12             301
 #define KEY_LEFT_SHIFT      340
 #define KEY_LEFT_CONTROL    341
 #define KEY_LEFT_ALT        342
@@ -255,13 +269,17 @@ void SetConfigFlags(unsigned int flags);
 void InitWindow(int width, int height, const char *title);
 void CloseWindow(void);
 bool WindowShouldClose(void);
+bool IsWindowFocused(void);   // false while unfocused or the app is backgrounded
 int  GetScreenWidth(void);
 int  GetScreenHeight(void);
+int  GetRenderWidth(void);    // backbuffer size in physical pixels (HiDPI-aware)
+int  GetRenderHeight(void);
 void SetTargetFPS(int fps);
 int  ChangeDirectory(const char *dir);
 const char *GetApplicationDirectory(void);
 float GetFrameTime(void);
 double GetTime(void);
+void SetRandomSeed(unsigned int seed);
 int  GetRandomValue(int min, int max);
 void DrawFPS(int posX, int posY);
 
@@ -315,6 +333,7 @@ void DrawCircleV(Vector2 center, float radius, Color c);
 void DrawCircleLines(int cx, int cy, float radius, Color c);
 void DrawEllipse(int cx, int cy, float rx, float ry, Color c);
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color c);
+void DrawTriangleStrip(const Vector2 *points, int pointCount, Color c);
 
 // Touch (mobile — desktop builds usually return 0 / mouse pos)
 int     GetTouchPointCount(void);
@@ -346,6 +365,14 @@ void      DrawTexturePro(Texture2D tex, Rectangle src, Rectangle dst,
 void      GenTextureMipmaps(Texture2D *tex);
 void      SetTextureFilter(Texture2D tex, int filter);
 
+// Render targets. Draw calls between Begin/EndTextureMode land in the
+// target instead of the window. Like raylib, the color texture reads
+// bottom-up: blit it with a negative source height to draw it upright.
+RenderTexture2D LoadRenderTexture(int width, int height);
+void            UnloadRenderTexture(RenderTexture2D target);
+void            BeginTextureMode(RenderTexture2D target);
+void            EndTextureMode(void);
+
 // ----------------------------------------------------------------------------
 // Images (CPU-side pixel buffers)
 // ----------------------------------------------------------------------------
@@ -409,6 +436,83 @@ bool CheckCollisionPointRec(Vector2 p, Rectangle r);
 Color Fade(Color c, float alpha);
 Color ColorAlpha(Color c, float alpha);
 
+// ----------------------------------------------------------------------------
+// Shim-only extensions (not in raylib). Game code guards uses with
+// #ifdef RAYLIB_SHIM_H.
+// ----------------------------------------------------------------------------
+
+// String-texture cache behind DrawText for lines the glyph atlases can't
+// serve. Counters cover the last completed frame; entries / bytes are live.
+typedef struct TextCacheStats {
+    int    hits;
+    int    misses;
+    int    evictions;
+    int    entries;
+    size_t bytesResident;   // w*h*4 summed over cached textures
+    size_t budgetBytes;
+} TextCacheStats;
+
+TextCacheStats GetTextCacheStats(void);
+// GPU-byte budget for the cache (default 8 MB). Shrinking evicts at once.
+void           SetTextCacheBudget(size_t bytes);
+
+// What the renderer submitted to SDL in the last completed frame. Only
+// counted in builds with RAYLIB_SHIM_STATS=1; otherwise all zero with
+// `enabled` false.
+typedef struct RenderStats {
+    bool enabled;
+    int  geometryCalls;     // SDL_RenderGeometry (batch flushes)
+    int  vertices;
+    int  indices;
+    int  textureBinds;      // submissions sampling a different texture
+    int  textureBlits;      // SDL_RenderTexture / SDL_RenderTextureRotated
+    int  fillRects;         // filled rects, batched (no SDL_RenderFillRect)
+    int  lineCalls;         // SDL_RenderLine / RenderPoint / RenderRect
+    int  targetSwitches;    // SDL_SetRenderTarget
+    int  textHits;          // string-texture cache, as in TextCacheStats
+    int  textMisses;
+    int  textureCreates;
+    int  textureDestroys;
+} RenderStats;
+
+RenderStats GetRenderStats(void);
+// Appends one CSV row per frame to `path` (truncated, header first); NULL
+// closes the file. False when the open fails or stats aren't compiled in.
+bool        SetRenderStatsCsv(const char *path);
+
+// Optional timeline zones inside the renderer (see systems/trace.h). NULL
+// hooks turn them off.
+void SetRenderTraceHooks(void (*begin)(const char *name), void (*end)(void));
+
+// Run without a display. Call before InitWindow; ignored afterwards.
+//   HEADLESS_NULL      counts draw submissions and drops them
+//   HEADLESS_SOFTWARE  renders into an offscreen surface on the CPU
+typedef enum {
+    HEADLESS_OFF = 0,
+    HEADLESS_NULL,
+    HEADLESS_SOFTWARE,
+} HeadlessMode;
+
+void               SetHeadlessMode(int mode);
+int                GetHeadlessMode(void);
+unsigned long long GetHeadlessSubmissions(void);   // dropped in null mode
+// Writes the last presented frame as a PNG (software mode only).
+bool               SaveHeadlessFrame(const char *path);
+
+// What the shim is holding right now, for soak runs watching for growth.
+// Texture bytes are w*h*4 over every texture it created and hasn't freed.
+typedef struct ShimMemoryStats {
+    int    liveTextures;
+    size_t liveTextureBytes;
+    int    liveFonts;
+    int    textCacheEntries;
+    size_t textCacheBytes;
+    int    glyphAtlases;        // atlases with a texture
+    size_t batchBytes;          // geometry batch buffers (grow-only)
+} ShimMemoryStats;
+
+ShimMemoryStats GetShimMemoryStats(void);
+
 #ifdef __cplusplus
 }
 #endif
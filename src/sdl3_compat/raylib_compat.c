@@ -6,17 +6,25 @@
 // the renderer) plus a fallback delay loop when SetTargetFPS is called and
 // vsync is disabled.
 //
+// Untextured shapes don't hit SDL one by one: they accumulate in a geometry
+// batch (see "Geometry batch") that flushes on texture/text draws, state
+// changes and EndDrawing.
+//
 // Input model: WindowShouldClose() runs once per frame and is the only
 // place we pump SDL events. It snapshots prev/cur key+mouse state so
 // IsKeyPressed/IsMouseButtonPressed can detect this-frame transitions.
 //
+// Headless: SetHeadlessMode before InitWindow swaps the window for a
+// software renderer drawing into an offscreen surface (see "Headless").
+//
 // Texture handles: SDL_Texture* lives in Texture2D._sdl. The raylib-style
 // `id` field is a non-zero sentinel (1) when loaded so existing checks
 // like `if (tex.id != 0)` keep working.
 //
-// Text path: each DrawTextEx call renders to an SDL_Surface via
-// TTF_RenderText_Blended, uploads to a one-shot SDL_Texture, blits, and
-// destroys. Slow but correct — caching arrives in a later pass.
+// Text path: lines are laid out from per-(font, size) glyph atlases and
+// drawn as textured quads through the geometry batch. Lines the atlas can't
+// serve fall back to whole-string textures from TTF_RenderText_Blended,
+// kept in a small cache (see "Glyph atlases" / "Rasterized-text cache").
 
 #include "raylib.h"
 
@@ -101,6 +109,7 @@ static int           g_logical_w = 0;
 static int           g_logical_h = 0;
 static unsigned int  g_config_flags = 0;
 static bool          g_should_quit = false;
+static bool          g_focused     = true;
 static int           g_target_fps = 0;
 static Uint64        g_last_frame_ns = 0;
 static Uint64        g_init_ns = 0;
@@ -108,6 +117,46 @@ static float         g_frame_dt_seconds = 0.0f;
 static char          g_app_dir[2048] = {0};
 static unsigned int  g_next_tex_id = 1;  // monotonic — only used as a sentinel
 
+// ---------------------------------------------------------------------------
+// Headless.
+//
+// Both headless modes run without a display or GPU: the renderer is SDL's
+// software renderer over an offscreen surface the size of the logical
+// canvas, and no video or audio subsystem is initialised. Textures, render
+// targets and text rasterization stay real in both, so every game code path
+// (atlas bakes, glyph uploads, the string cache) behaves as on device.
+//
+//   HEADLESS_SOFTWARE  draws every frame into the surface; SaveHeadlessFrame
+//                      writes the last presented one as a PNG.
+//   HEADLESS_NULL      drops each draw submission (geometry, blits, lines,
+//                      clears, present) after counting it, so a run measures
+//                      the game's CPU cost without the rasterizer's.
+// ---------------------------------------------------------------------------
+
+static int                g_headless = HEADLESS_OFF;
+static SDL_Surface       *g_headless_surface = NULL;
+static unsigned long long g_null_submits = 0;
+
+// True when the caller should skip its SDL draw call (null mode).
+static inline bool NullSubmit(void) {
+    if (g_headless != HEADLESS_NULL) return false;
+    g_null_submits++;
+    return true;
+}
+
+void SetHeadlessMode(int mode) {
+    if (!g_renderer) g_headless = mode;
+}
+
+int GetHeadlessMode(void) { return g_headless; }
+
+unsigned long long GetHeadlessSubmissions(void) { return g_null_submits; }
+
+bool SaveHeadlessFrame(const char *path) {
+    if (g_headless != HEADLESS_SOFTWARE || !g_headless_surface) return false;
+    return IMG_SavePNG(g_headless_surface, path);
+}
+
 // Keyboard state (indexed by SDL_Scancode)
 #define MAX_SCANCODES 512
 static bool g_key_cur[MAX_SCANCODES];
@@ -139,6 +188,324 @@ static inline void XformPoint(float *x, float *y) {
 }
 static inline float XformLen(float v) { return g_view_active ? v * g_view_zoom : v; }
 
+// ---------------------------------------------------------------------------
+// Render stats.
+//
+// Per-frame counts of what actually reaches SDL, for holding the mobile
+// draw-call budget and spotting a screen that suddenly submits thousands of
+// batches. Compiled in only with RAYLIB_SHIM_STATS=1 (CMake option
+// DDKP_RENDER_STATS); otherwise every STAT_* below expands to nothing and
+// GetRenderStats reports `enabled = false`.
+//
+// A texture bind is a submission sampling a different texture than the
+// previous textured one. Counters roll over in EndDrawing, which also
+// appends the finished frame to the CSV opened by SetRenderStatsCsv.
+// ---------------------------------------------------------------------------
+
+#ifndef RAYLIB_SHIM_STATS
+#define RAYLIB_SHIM_STATS 0
+#endif
+
+#if RAYLIB_SHIM_STATS
+static RenderStats        g_stats_cur, g_stats_last;
+static const SDL_Texture *g_stats_bound = NULL;
+static FILE              *g_stats_csv = NULL;
+static unsigned long      g_stats_frame = 0;
+
+#define STAT_ADD(field, n) (g_stats_cur.field += (n))
+#define STAT_BIND(tex) \
+    do { if ((tex) && (tex) != g_stats_bound) { g_stats_cur.textureBinds++; g_stats_bound = (tex); } } while (0)
+#else
+#define STAT_ADD(field, n) ((void)0)
+#define STAT_BIND(tex)     ((void)0)
+#endif
+
+// Live texture residency, always counted (two adds per create/destroy) so
+// a soak run can watch for growth: see GetShimMemoryStats.
+static int    g_live_textures = 0;
+static size_t g_live_texture_bytes = 0;
+static int    g_live_fonts = 0;
+
+static size_t TextureBytes(SDL_Texture *t) {
+    float w = 0, h = 0;
+    SDL_GetTextureSize(t, &w, &h);
+    return (size_t)w * (size_t)h * 4;
+}
+
+static inline void CreatedTexture(SDL_Texture *t) {
+    STAT_ADD(textureCreates, 1);
+    g_live_textures++;
+    g_live_texture_bytes += TextureBytes(t);
+}
+
+static inline void DestroyTexture(SDL_Texture *t) {
+    STAT_ADD(textureDestroys, 1);
+    g_live_textures--;
+    g_live_texture_bytes -= TextureBytes(t);
+    SDL_DestroyTexture(t);
+}
+
+// Trace zones around the renderer's own expensive steps (SDL/TTF init and
+// window creation, batch submits, present, frame pacing, glyph / string
+// rasterization). The game installs its recorder with SetRenderTraceHooks;
+// unset, each zone is one branch.
+static void (*g_trace_begin)(const char *name) = NULL;
+static void (*g_trace_end)(void) = NULL;
+
+#define ZONE_BEGIN(name) do { if (g_trace_begin) g_trace_begin(name); } while (0)
+#define ZONE_END()       do { if (g_trace_end) g_trace_end(); } while (0)
+
+void SetRenderTraceHooks(void (*begin)(const char *name), void (*end)(void)) {
+    g_trace_begin = begin;
+    g_trace_end   = end;
+}
+
+#define RENDER_STATS_CSV_HEADER \
+    "frame,geometry_calls,vertices,indices,texture_binds,texture_blits," \
+    "fill_rects,line_calls,target_switches,text_hits,text_misses," \
+    "texture_creates,texture_destroys\n"
+
+RenderStats GetRenderStats(void) {
+#if RAYLIB_SHIM_STATS
+    return g_stats_last;
+#else
+    return (RenderStats){0};
+#endif
+}
+
+bool SetRenderStatsCsv(const char *path) {
+#if RAYLIB_SHIM_STATS
+    if (g_stats_csv) { fclose(g_stats_csv); g_stats_csv = NULL; }
+    if (!path) return true;
+    g_stats_csv = fopen(RewriteSavePath(path), "w");
+    if (!g_stats_csv) {
+        fprintf(stderr, "SetRenderStatsCsv(%s) failed\n", path);
+        return false;
+    }
+    fputs(RENDER_STATS_CSV_HEADER, g_stats_csv);
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+// Called from EndDrawing once the batch is flushed and the text cache has
+// published its counters.
+static void RenderStatsEndFrame(void) {
+#if RAYLIB_SHIM_STATS
+    TextCacheStats ts = GetTextCacheStats();
+    g_stats_cur.enabled    = true;
+    g_stats_cur.textHits   = ts.hits;
+    g_stats_cur.textMisses = ts.misses;
+    g_stats_last = g_stats_cur;
+    if (g_stats_csv) {
+        const RenderStats *r = &g_stats_last;
+        fprintf(g_stats_csv, "%lu,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d\n",
+                g_stats_frame, r->geometryCalls, r->vertices, r->indices,
+                r->textureBinds, r->textureBlits, r->fillRects, r->lineCalls,
+                r->targetSwitches, r->textHits, r->textMisses,
+                r->textureCreates, r->textureDestroys);
+    }
+    g_stats_frame++;
+    memset(&g_stats_cur, 0, sizeof(g_stats_cur));
+    g_stats_bound = NULL;   // SDL re-binds after present
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Geometry batch.
+//
+// Every untextured primitive (rects, lines, circles, rounded rects,
+// triangles) appends screen-space triangles to one growing vertex/index
+// buffer instead of issuing its own SDL_RenderGeometry. The batch goes out
+// as a single call when something that SDL orders separately comes along:
+// a texture blit, text, a point/line/outline primitive, a blend, scissor or
+// render-target change, a clear, or present. A field frame's few thousand
+// ink segments collapse to a few dozen submissions — the per-call overhead
+// is what hurts on the iOS / Android GPU backends.
+//
+// Vertex colours carry the tint, so colour changes never break a batch.
+// SDL applies the renderer's draw blend mode to untextured geometry, which
+// is why blend changes flush. Buffers grow by doubling and are reused every
+// frame; BATCH_MAX_VERTS bounds a single submission.
+//
+// The batch can also hold textured quads from one texture at a time (glyph
+// runs from the text atlas); switching between that texture and plain
+// shapes flushes.
+// ---------------------------------------------------------------------------
+
+#define BATCH_MAX_VERTS 65536
+
+static SDL_Vertex  *g_batch_v = NULL;
+static int         *g_batch_i = NULL;
+static int          g_batch_nv = 0, g_batch_cap_v = 0;
+static int          g_batch_ni = 0, g_batch_cap_i = 0;
+static SDL_Texture *g_batch_tex = NULL;   // NULL = untextured shapes
+
+static void BatchFlush(void) {
+    if (g_batch_ni > 0) {
+        STAT_ADD(geometryCalls, 1);
+        STAT_ADD(vertices, g_batch_nv);
+        STAT_ADD(indices, g_batch_ni);
+        STAT_BIND(g_batch_tex);
+        if (!NullSubmit()) {
+            ZONE_BEGIN("SDL_RenderGeometry");
+            SDL_RenderGeometry(g_renderer, g_batch_tex, g_batch_v, g_batch_nv, g_batch_i, g_batch_ni);
+            ZONE_END();
+        }
+    }
+    g_batch_nv = 0;
+    g_batch_ni = 0;
+}
+
+static void BatchFree(void) {
+    free(g_batch_v); g_batch_v = NULL; g_batch_nv = g_batch_cap_v = 0;
+    free(g_batch_i); g_batch_i = NULL; g_batch_ni = g_batch_cap_i = 0;
+    g_batch_tex = NULL;
+}
+
+// Reserve nv vertices + ni indices at the batch tail and count them as
+// used — the caller must fill every slot. *idx receives the index slots and
+// *base the vertex number that indices are relative to. Returns NULL (and
+// the primitive is dropped) only if the buffers can't grow. `tex` is the
+// texture the vertices sample (NULL for shapes).
+static SDL_Vertex *BatchAllocTex(SDL_Texture *tex, int nv, int ni, int **idx, int *base) {
+    if (tex != g_batch_tex) {
+        BatchFlush();
+        g_batch_tex = tex;
+    }
+    if (g_batch_nv + nv > BATCH_MAX_VERTS) BatchFlush();
+    if (g_batch_nv + nv > g_batch_cap_v) {
+        int cap = g_batch_cap_v ? g_batch_cap_v : 1024;
+        while (cap < g_batch_nv + nv) cap *= 2;
+        SDL_Vertex *nvbuf = (SDL_Vertex*)realloc(g_batch_v, sizeof(SDL_Vertex) * (size_t)cap);
+        if (!nvbuf) return NULL;
+        g_batch_v = nvbuf;
+        g_batch_cap_v = cap;
+    }
+    if (g_batch_ni + ni > g_batch_cap_i) {
+        int cap = g_batch_cap_i ? g_batch_cap_i : 1536;
+        while (cap < g_batch_ni + ni) cap *= 2;
+        int *nibuf = (int*)realloc(g_batch_i, sizeof(int) * (size_t)cap);
+        if (!nibuf) return NULL;
+        g_batch_i = nibuf;
+        g_batch_cap_i = cap;
+    }
+    SDL_Vertex *v = g_batch_v + g_batch_nv;
+    *idx  = g_batch_i + g_batch_ni;
+    *base = g_batch_nv;
+    g_batch_nv += nv;
+    g_batch_ni += ni;
+    return v;
+}
+
+static inline SDL_Vertex *BatchAlloc(int nv, int ni, int **idx, int *base) {
+    return BatchAllocTex(NULL, nv, ni, idx, base);
+}
+
+static inline SDL_FColor ToFColor(Color c) {
+    return (SDL_FColor){ c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
+}
+
+// Screen-space quad p0..p3 (either winding), one colour per edge pair.
+static void BatchQuad(SDL_FPoint p0, SDL_FPoint p1, SDL_FPoint p2, SDL_FPoint p3,
+                      SDL_FColor c01, SDL_FColor c23) {
+    int *idx, base;
+    SDL_Vertex *v = BatchAlloc(4, 6, &idx, &base);
+    if (!v) return;
+    v[0] = (SDL_Vertex){ p0, c01, {0,0} };
+    v[1] = (SDL_Vertex){ p1, c01, {0,0} };
+    v[2] = (SDL_Vertex){ p2, c23, {0,0} };
+    v[3] = (SDL_Vertex){ p3, c23, {0,0} };
+    idx[0] = base;     idx[1] = base + 1; idx[2] = base + 2;
+    idx[3] = base;     idx[4] = base + 2; idx[5] = base + 3;
+}
+
+static void BatchRect(float x, float y, float w, float h, SDL_FColor fc) {
+    STAT_ADD(fillRects, 1);
+    BatchQuad((SDL_FPoint){ x, y },     (SDL_FPoint){ x + w, y },
+              (SDL_FPoint){ x + w, y + h }, (SDL_FPoint){ x, y + h }, fc, fc);
+}
+
+// ---------------------------------------------------------------------------
+// Tessellation tables.
+//
+// Circles, ellipses and rounded-rect corners read unit vectors from tables
+// built once per segment count, so steady-state drawing does no cosf/sinf.
+// The procedural sprites draw dozens of circles and rounded rects per
+// character per frame; with the geometry batch as the emission arena, the
+// shape path does no heap or trig work after the first frame.
+//
+// Level of detail: segment counts come from the on-screen radius in device
+// pixels (sagitta ≤ TESS_MAX_ERROR), rounded up to a multiple of 4 so every
+// quarter arc splits evenly. A 2 px speck gets 8 segments; a 200 px disc 48.
+// ---------------------------------------------------------------------------
+
+#define TESS_MAX_SEGS   64
+#define TESS_MIN_SEGS   8
+#define TESS_MAX_ERROR  0.5f     // max chord deviation, device pixels
+
+// g_tess_circle[n][i] = (cos, sin) of i/n of a full turn, i in [0, n].
+// g_tess_arc[n][i]    = (cos, sin) of i/n of a quarter turn, i in [0, n].
+static SDL_FPoint g_tess_circle[TESS_MAX_SEGS + 1][TESS_MAX_SEGS + 1];
+static SDL_FPoint g_tess_arc[TESS_MAX_SEGS + 1][TESS_MAX_SEGS + 1];
+static bool       g_tess_circle_built[TESS_MAX_SEGS + 1];
+static bool       g_tess_arc_built[TESS_MAX_SEGS + 1];
+
+// Device pixels per drawing-space pixel on the window target. Refreshed in
+// BeginDrawing; render targets are sampled 1:1 so they use 1.0.
+static float g_tess_density = 1.0f;
+static bool  g_target_active = false;
+
+static const SDL_FPoint *TessCircle(int n) {
+    if (!g_tess_circle_built[n]) {
+        for (int i = 0; i <= n; i++) {
+            float a = (float)i / (float)n * 6.28318530718f;
+            g_tess_circle[n][i] = (SDL_FPoint){ cosf(a), sinf(a) };
+        }
+        g_tess_circle_built[n] = true;
+    }
+    return g_tess_circle[n];
+}
+
+static const SDL_FPoint *TessArc(int n) {
+    if (!g_tess_arc_built[n]) {
+        for (int i = 0; i <= n; i++) {
+            float a = (float)i / (float)n * 1.5707963f;
+            g_tess_arc[n][i] = (SDL_FPoint){ cosf(a), sinf(a) };
+        }
+        g_tess_arc_built[n] = true;
+    }
+    return g_tess_arc[n];
+}
+
+// Full-circle segment count for a screen-space radius.
+static int TessSegments(float r) {
+    float rd = r * (g_target_active ? 1.0f : g_tess_density);
+    if (rd <= TESS_MAX_ERROR * 2.0f) return TESS_MIN_SEGS;
+    // Sagitta of a chord spanning angle t: rd * (1 - cos(t/2)) ≈ rd*t²/8.
+    float step = sqrtf(8.0f * TESS_MAX_ERROR / rd);
+    int n = (int)ceilf(6.28318530718f / step);
+    n = (n + 3) & ~3;
+    if (n < TESS_MIN_SEGS) n = TESS_MIN_SEGS;
+    if (n > TESS_MAX_SEGS) n = TESS_MAX_SEGS;
+    return n;
+}
+
+// Unit vector at step i of a quarter arc starting at -π/2 + corner·π/2
+// (corner 0 = TR, 1 = BR, 2 = BL, 3 = TL). Quarter-turn rotations are exact
+// swaps/negations of the base table, so one table serves all four corners.
+static inline SDL_FPoint TessCorner(const SDL_FPoint *arc, int corner, int i) {
+    SDL_FPoint u = arc[i];
+    switch (corner) {
+        case 0:  return (SDL_FPoint){  u.y, -u.x };
+        case 1:  return (SDL_FPoint){  u.x,  u.y };
+        case 2:  return (SDL_FPoint){ -u.y,  u.x };
+        default: return (SDL_FPoint){ -u.x, -u.y };
+    }
+}
+
 // ---------------------------------------------------------------------------
 // Key translation: raylib KEY_* → SDL_Scancode
 // ---------------------------------------------------------------------------
@@ -174,6 +541,8 @@ static SDL_Scancode RlKeyToScancode(int key) {
         case KEY_F8:           return SDL_SCANCODE_F8;
         case KEY_F9:           return SDL_SCANCODE_F9;
         case KEY_F10:          return SDL_SCANCODE_F10;
+        case KEY_F11:          return SDL_SCANCODE_F11;
+        case KEY_F12:          return SDL_SCANCODE_F12;
         case KEY_LEFT_SHIFT:    return SDL_SCANCODE_LSHIFT;
         case KEY_LEFT_CONTROL:  return SDL_SCANCODE_LCTRL;
         case KEY_LEFT_ALT:      return SDL_SCANCODE_LALT;
@@ -206,27 +575,44 @@ void InitWindow(int width, int height, const char *title) {
     // but set explicitly so we don't depend on platform defaults shifting.
     SDL_SetHint(SDL_HINT_TOUCH_MOUSE_EVENTS, "1");
 
-    if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
+    // Headless needs only the event queue (WindowShouldClose still pumps it).
+    SDL_InitFlags sf = g_headless ? SDL_INIT_EVENTS : (SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+    ZONE_BEGIN("SDL_Init");
+    if (!SDL_Init(sf)) {
         fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
         exit(1);
     }
+    ZONE_END();
+    ZONE_BEGIN("TTF_Init");
     if (!TTF_Init()) {
         fprintf(stderr, "TTF_Init failed: %s\n", SDL_GetError());
         exit(1);
     }
+    ZONE_END();
+
+    if (g_headless) {
+        g_headless_surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+        g_renderer = g_headless_surface ? SDL_CreateSoftwareRenderer(g_headless_surface) : NULL;
+        if (!g_renderer) {
+            fprintf(stderr, "headless renderer failed: %s\n", SDL_GetError());
+            exit(1);
+        }
+    } else {
+        SDL_WindowFlags wf = 0;
+        if (g_config_flags & FLAG_WINDOW_HIGHDPI)  wf |= SDL_WINDOW_HIGH_PIXEL_DENSITY;
+        if (g_config_flags & FLAG_WINDOW_RESIZABLE) wf |= SDL_WINDOW_RESIZABLE;
+        if (g_config_flags & FLAG_FULLSCREEN_MODE)  wf |= SDL_WINDOW_FULLSCREEN;
+
+        ZONE_BEGIN("SDL_CreateWindowAndRenderer");
+        if (!SDL_CreateWindowAndRenderer(title, width, height, wf, &g_window, &g_renderer)) {
+            fprintf(stderr, "CreateWindowAndRenderer failed: %s\n", SDL_GetError());
+            exit(1);
+        }
+        ZONE_END();
 
-    SDL_WindowFlags wf = 0;
-    if (g_config_flags & FLAG_WINDOW_HIGHDPI)  wf |= SDL_WINDOW_HIGH_PIXEL_DENSITY;
-    if (g_config_flags & FLAG_WINDOW_RESIZABLE) wf |= SDL_WINDOW_RESIZABLE;
-    if (g_config_flags & FLAG_FULLSCREEN_MODE)  wf |= SDL_WINDOW_FULLSCREEN;
-
-    if (!SDL_CreateWindowAndRenderer(title, width, height, wf, &g_window, &g_renderer)) {
-        fprintf(stderr, "CreateWindowAndRenderer failed: %s\n", SDL_GetError());
-        exit(1);
-    }
-
-    if (g_config_flags & FLAG_VSYNC_HINT) {
-        SDL_SetRenderVSync(g_renderer, 1);
+        if (g_config_flags & FLAG_VSYNC_HINT) {
+            SDL_SetRenderVSync(g_renderer, 1);
+        }
     }
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_BLEND);
     // Logical presentation size lets us use raylib-style coordinates while
@@ -246,17 +632,23 @@ void InitWindow(int width, int height, const char *title) {
     }
 }
 
-// Forward decls: rasterized-text cache lives lower in the file but
-// CloseWindow / EndDrawing need to reach into it.
+// Forward decls: rasterized-text cache and glyph atlases live lower in the
+// file but CloseWindow / EndDrawing need to reach into them.
 static void   TextCacheClear(void);
+static void   TextCacheEndFrame(void);
+static void   GlyphAtlasClear(void);
 static Uint64 sTextFrame;
 
 void CloseWindow(void) {
     // Cached text textures live on the renderer — destroy them before the
     // renderer goes away so SDL_DestroyTexture sees a valid backend.
     TextCacheClear();
+    GlyphAtlasClear();
+    BatchFree();
+    SetRenderStatsCsv(NULL);
     if (g_renderer) { SDL_DestroyRenderer(g_renderer); g_renderer = NULL; }
     if (g_window)   { SDL_DestroyWindow(g_window);     g_window   = NULL; }
+    if (g_headless_surface) { SDL_DestroySurface(g_headless_surface); g_headless_surface = NULL; }
     TTF_Quit();
     SDL_Quit();
 }
@@ -279,6 +671,17 @@ bool WindowShouldClose(void) {
             case SDL_EVENT_QUIT:
                 g_should_quit = true;
                 break;
+            // Mobile backgrounding reads as losing focus, like raylib's
+            // desktop/web IsWindowFocused.
+            case SDL_EVENT_WINDOW_FOCUS_LOST:
+            case SDL_EVENT_WILL_ENTER_BACKGROUND:
+            case SDL_EVENT_DID_ENTER_BACKGROUND:
+                g_focused = false;
+                break;
+            case SDL_EVENT_WINDOW_FOCUS_GAINED:
+            case SDL_EVENT_DID_ENTER_FOREGROUND:
+                g_focused = true;
+                break;
             case SDL_EVENT_KEY_DOWN:
                 if (e.key.scancode < MAX_SCANCODES) g_key_cur[e.key.scancode] = true;
                 if (e.key.scancode == SDL_SCANCODE_ESCAPE) g_should_quit = true;
@@ -327,9 +730,24 @@ bool WindowShouldClose(void) {
     return g_should_quit;
 }
 
+bool IsWindowFocused(void) { return g_focused; }
+
 int GetScreenWidth(void)  { return g_logical_w; }
 int GetScreenHeight(void) { return g_logical_h; }
 
+// Physical backbuffer size. Logical presentation maps GetScreenWidth() onto
+// this, so (render / screen) is the device-pixel scale of one game pixel.
+int GetRenderWidth(void) {
+    int w = g_logical_w, h = 0;
+    if (g_renderer) SDL_GetRenderOutputSize(g_renderer, &w, &h);
+    return w;
+}
+int GetRenderHeight(void) {
+    int w = 0, h = g_logical_h;
+    if (g_renderer) SDL_GetRenderOutputSize(g_renderer, &w, &h);
+    return h;
+}
+
 void SetTargetFPS(int fps) {
     g_target_fps = fps;
     g_last_frame_ns = SDL_GetTicksNS();
@@ -348,13 +766,25 @@ const char *GetApplicationDirectory(void) {
 // ---------------------------------------------------------------------------
 
 void BeginDrawing(void) {
-    // SDL3 doesn't need an explicit begin — RenderClear/draw calls just go.
-    // We model BeginDrawing as a no-op; ClearBackground does the work.
+    // SDL3 doesn't need an explicit begin — RenderClear/draw calls just go;
+    // ClearBackground does the work. Only the tessellation LOD needs to know
+    // how many device pixels this frame's logical pixels cover.
+    int rw = 0, rh = 0;
+    if (g_logical_w > 0 && SDL_GetRenderOutputSize(g_renderer, &rw, &rh) && rw > 0) {
+        g_tess_density = (float)rw / (float)g_logical_w;
+    }
 }
 
 void EndDrawing(void) {
+    BatchFlush();
+    TextCacheEndFrame();
+    RenderStatsEndFrame();
     sTextFrame++;
-    SDL_RenderPresent(g_renderer);
+    if (!NullSubmit()) {
+        ZONE_BEGIN("SDL_RenderPresent");
+        SDL_RenderPresent(g_renderer);
+        ZONE_END();
+    }
 
     // Soft FPS cap. Applied even when vsync is on, because iOS Pro models /
     // some iPad Pros vsync at 120Hz and the game's frame-counted update
@@ -364,7 +794,11 @@ void EndDrawing(void) {
         const Uint64 frame_ns = 1000000000ULL / (Uint64)g_target_fps;
         const Uint64 now = SDL_GetTicksNS();
         const Uint64 elapsed = now - g_last_frame_ns;
-        if (elapsed < frame_ns) SDL_DelayNS(frame_ns - elapsed);
+        if (elapsed < frame_ns) {
+            ZONE_BEGIN("FramePacing");
+            SDL_DelayNS(frame_ns - elapsed);
+            ZONE_END();
+        }
     }
 
     // Frame-time bookkeeping for GetFrameTime.
@@ -377,6 +811,8 @@ float GetFrameTime(void) { return g_frame_dt_seconds; }
 double GetTime(void)     { return (double)(SDL_GetTicksNS() - g_init_ns) / 1.0e9; }
 
 void ClearBackground(Color c) {
+    BatchFlush();
+    if (NullSubmit()) return;
     SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
     SDL_RenderClear(g_renderer);
 }
@@ -388,17 +824,13 @@ void ClearBackground(Color c) {
 void DrawRectangle(int x, int y, int w, int h, Color c) {
     float fx = (float)x, fy = (float)y;
     XformPoint(&fx, &fy);
-    SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
-    SDL_FRect r = { fx, fy, XformLen((float)w), XformLen((float)h) };
-    SDL_RenderFillRect(g_renderer, &r);
+    BatchRect(fx, fy, XformLen((float)w), XformLen((float)h), ToFColor(c));
 }
 
 void DrawRectangleRec(Rectangle r, Color c) {
     float fx = r.x, fy = r.y;
     XformPoint(&fx, &fy);
-    SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
-    SDL_FRect fr = { fx, fy, XformLen(r.width), XformLen(r.height) };
-    SDL_RenderFillRect(g_renderer, &fr);
+    BatchRect(fx, fy, XformLen(r.width), XformLen(r.height), ToFColor(c));
 }
 
 void DrawRectangleLinesEx(Rectangle r, float thickness, Color c) {
@@ -407,56 +839,39 @@ void DrawRectangleLinesEx(Rectangle r, float thickness, Color c) {
     float fw = XformLen(r.width);
     float fh = XformLen(r.height);
     float ft = XformLen(thickness);
-    SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
-    SDL_FRect top    = { fx,           fy,           fw, ft };
-    SDL_FRect bottom = { fx,           fy + fh - ft, fw, ft };
-    SDL_FRect left   = { fx,           fy,           ft, fh };
-    SDL_FRect right  = { fx + fw - ft, fy,           ft, fh };
-    SDL_RenderFillRect(g_renderer, &top);
-    SDL_RenderFillRect(g_renderer, &bottom);
-    SDL_RenderFillRect(g_renderer, &left);
-    SDL_RenderFillRect(g_renderer, &right);
+    SDL_FColor fc = ToFColor(c);
+    BatchRect(fx,           fy,           fw, ft, fc);   // top
+    BatchRect(fx,           fy + fh - ft, fw, ft, fc);   // bottom
+    BatchRect(fx,           fy,           ft, fh, fc);   // left
+    BatchRect(fx + fw - ft, fy,           ft, fh, fc);   // right
 }
 
 void DrawRectangleGradientV(int x, int y, int w, int h, Color top, Color bottom) {
     float fx = (float)x, fy = (float)y;
     XformPoint(&fx, &fy);
     float fw = XformLen((float)w), fh = XformLen((float)h);
-    SDL_FColor c_top    = { top.r/255.0f,    top.g/255.0f,    top.b/255.0f,    top.a/255.0f };
-    SDL_FColor c_bottom = { bottom.r/255.0f, bottom.g/255.0f, bottom.b/255.0f, bottom.a/255.0f };
-    SDL_Vertex v[4] = {
-        { { fx,      fy      }, c_top,    {0,0} },
-        { { fx + fw, fy      }, c_top,    {0,0} },
-        { { fx + fw, fy + fh }, c_bottom, {0,0} },
-        { { fx,      fy + fh }, c_bottom, {0,0} },
-    };
-    int idx[6] = { 0, 1, 2, 0, 2, 3 };
-    SDL_RenderGeometry(g_renderer, NULL, v, 4, idx, 6);
+    BatchQuad((SDL_FPoint){ fx, fy },      (SDL_FPoint){ fx + fw, fy },
+              (SDL_FPoint){ fx + fw, fy + fh }, (SDL_FPoint){ fx, fy + fh },
+              ToFColor(top), ToFColor(bottom));
 }
 
 void DrawCircle(int cx, int cy, float radius, Color c) {
     float fcx = (float)cx, fcy = (float)cy;
     XformPoint(&fcx, &fcy);
     float r = XformLen(radius);
-    int segments = (int)(r * 0.6f); if (segments < 12) segments = 12; if (segments > 64) segments = 64;
-    SDL_FColor fc = { c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
-    SDL_Vertex *verts = (SDL_Vertex*)malloc(sizeof(SDL_Vertex) * (segments + 1));
-    int *idx = (int*)malloc(sizeof(int) * segments * 3);
-    verts[0].position = (SDL_FPoint){ fcx, fcy };
-    verts[0].color = fc;
-    verts[0].tex_coord = (SDL_FPoint){0,0};
+    int segments = TessSegments(r);
+    const SDL_FPoint *unit = TessCircle(segments);
+    SDL_FColor fc = ToFColor(c);
+    int *idx, base;
+    SDL_Vertex *verts = BatchAlloc(segments + 1, segments * 3, &idx, &base);
+    if (!verts) return;
+    verts[0] = (SDL_Vertex){ { fcx, fcy }, fc, {0,0} };
     for (int i = 0; i < segments; i++) {
-        float a = (float)i / (float)segments * 6.28318530718f;
-        verts[i + 1].position = (SDL_FPoint){ fcx + cosf(a) * r, fcy + sinf(a) * r };
-        verts[i + 1].color = fc;
-        verts[i + 1].tex_coord = (SDL_FPoint){0,0};
-        idx[i*3 + 0] = 0;
-        idx[i*3 + 1] = i + 1;
-        idx[i*3 + 2] = (i + 1) % segments + 1;
+        verts[i + 1] = (SDL_Vertex){ { fcx + unit[i].x * r, fcy + unit[i].y * r }, fc, {0,0} };
+        idx[i*3 + 0] = base;
+        idx[i*3 + 1] = base + i + 1;
+        idx[i*3 + 2] = base + (i + 1) % segments + 1;
     }
-    SDL_RenderGeometry(g_renderer, NULL, verts, segments + 1, idx, segments * 3);
-    free(verts);
-    free(idx);
 }
 
 void DrawLineEx(Vector2 a, Vector2 b, float thickness, Color c) {
@@ -468,15 +883,9 @@ void DrawLineEx(Vector2 a, Vector2 b, float thickness, Color c) {
     if (len < 0.0001f) return;
     float nx = -dy / len * t * 0.5f;
     float ny =  dx / len * t * 0.5f;
-    SDL_FColor fc = { c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
-    SDL_Vertex v[4] = {
-        { { a.x - nx, a.y - ny }, fc, {0,0} },
-        { { a.x + nx, a.y + ny }, fc, {0,0} },
-        { { b.x + nx, b.y + ny }, fc, {0,0} },
-        { { b.x - nx, b.y - ny }, fc, {0,0} },
-    };
-    int idx[6] = { 0, 1, 2, 0, 2, 3 };
-    SDL_RenderGeometry(g_renderer, NULL, v, 4, idx, 6);
+    SDL_FColor fc = ToFColor(c);
+    BatchQuad((SDL_FPoint){ a.x - nx, a.y - ny }, (SDL_FPoint){ a.x + nx, a.y + ny },
+              (SDL_FPoint){ b.x + nx, b.y + ny }, (SDL_FPoint){ b.x - nx, b.y - ny }, fc, fc);
 }
 
 // ---------------------------------------------------------------------------
@@ -491,6 +900,7 @@ Texture2D LoadTexture(const char *path) {
         fprintf(stderr, "LoadTexture(%s) failed: %s\n", path, SDL_GetError());
         return t;
     }
+    CreatedTexture(st);
     SDL_SetTextureScaleMode(st, SDL_SCALEMODE_LINEAR);
     float w = 0, h = 0;
     SDL_GetTextureSize(st, &w, &h);
@@ -512,6 +922,7 @@ Texture2D LoadTextureFromImage(Image img) {
     SDL_Texture *st = SDL_CreateTextureFromSurface(g_renderer, surf);
     SDL_DestroySurface(surf);
     if (!st) return t;
+    CreatedTexture(st);
     SDL_SetTextureScaleMode(st, SDL_SCALEMODE_LINEAR);
     t.id     = g_next_tex_id++;
     t.width  = img.width;
@@ -521,26 +932,44 @@ Texture2D LoadTextureFromImage(Image img) {
 }
 
 void UnloadTexture(Texture2D tex) {
-    if (tex._sdl) SDL_DestroyTexture((SDL_Texture*)tex._sdl);
+    if (tex._sdl) DestroyTexture((SDL_Texture*)tex._sdl);
 }
 
 void DrawTexturePro(Texture2D tex, Rectangle src, Rectangle dst,
                     Vector2 origin, float rotation, Color tint) {
     SDL_Texture *st = (SDL_Texture*)tex._sdl;
     if (!st) return;
+    BatchFlush();
     SDL_SetTextureColorMod(st, tint.r, tint.g, tint.b);
     SDL_SetTextureAlphaMod(st, tint.a);
 
+    // raylib semantics: a negative source width/height mirrors the sample.
+    // raylib's GL render targets store rows bottom-up, so game code blits
+    // them with a negative height to get an upright image. SDL targets are
+    // stored top-down — for those, mirror the source rect vertically and
+    // invert the flip so the same call draws the same picture.
+    int flip = SDL_FLIP_NONE;
+    if (src.width < 0.0f)  { src.width  = -src.width;  flip |= SDL_FLIP_HORIZONTAL; }
+    if (src.height < 0.0f) { src.height = -src.height; flip |= SDL_FLIP_VERTICAL; }
+    if (tex._target) {
+        src.y = (float)tex.height - src.y - src.height;
+        flip ^= SDL_FLIP_VERTICAL;
+    }
+
     SDL_FRect s = { src.x, src.y, src.width, src.height };
     float dx = dst.x - origin.x, dy = dst.y - origin.y;
     XformPoint(&dx, &dy);
     SDL_FRect d = { dx, dy, XformLen(dst.width), XformLen(dst.height) };
 
-    if (rotation == 0.0f) {
+    STAT_ADD(textureBlits, 1);
+    STAT_BIND(st);
+    if (NullSubmit()) return;
+    if (rotation == 0.0f && flip == SDL_FLIP_NONE) {
         SDL_RenderTexture(g_renderer, st, &s, &d);
     } else {
         SDL_FPoint center = { XformLen(origin.x), XformLen(origin.y) };
-        SDL_RenderTextureRotated(g_renderer, st, &s, &d, rotation, &center, SDL_FLIP_NONE);
+        SDL_RenderTextureRotated(g_renderer, st, &s, &d, rotation, &center,
+                                 (SDL_FlipMode)flip);
     }
 }
 
@@ -556,6 +985,54 @@ void SetTextureFilter(Texture2D tex, int filter) {
         filter == TEXTURE_FILTER_POINT ? SDL_SCALEMODE_NEAREST : SDL_SCALEMODE_LINEAR);
 }
 
+// ---------------------------------------------------------------------------
+// Render targets
+// ---------------------------------------------------------------------------
+
+RenderTexture2D LoadRenderTexture(int width, int height) {
+    RenderTexture2D rt = {0};
+    if (width <= 0 || height <= 0) return rt;
+    SDL_Texture *st = SDL_CreateTexture(g_renderer, SDL_PIXELFORMAT_RGBA32,
+                                        SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!st) {
+        fprintf(stderr, "LoadRenderTexture(%dx%d) failed: %s\n", width, height, SDL_GetError());
+        return rt;
+    }
+    CreatedTexture(st);
+    SDL_SetTextureBlendMode(st, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(st, SDL_SCALEMODE_LINEAR);
+    rt.id                 = g_next_tex_id++;
+    rt.texture.id         = g_next_tex_id++;
+    rt.texture.width      = width;
+    rt.texture.height     = height;
+    rt.texture.mipmaps    = 1;
+    rt.texture._sdl       = st;
+    rt.texture._target    = 1;
+    return rt;
+}
+
+void UnloadRenderTexture(RenderTexture2D target) {
+    if (target.texture._sdl) DestroyTexture((SDL_Texture*)target.texture._sdl);
+}
+
+// Target switches flush the geometry batch (it belongs to the old target)
+// but are otherwise cheap — SDL_Renderer queues per target. Logical
+// presentation only applies to the window target — inside texture mode,
+// coordinates are plain texture pixels.
+void BeginTextureMode(RenderTexture2D target) {
+    BatchFlush();
+    STAT_ADD(targetSwitches, 1);
+    SDL_SetRenderTarget(g_renderer, (SDL_Texture*)target.texture._sdl);
+    g_target_active = true;
+}
+
+void EndTextureMode(void) {
+    BatchFlush();
+    STAT_ADD(targetSwitches, 1);
+    SDL_SetRenderTarget(g_renderer, NULL);
+    g_target_active = false;
+}
+
 // ---------------------------------------------------------------------------
 // Images
 // ---------------------------------------------------------------------------
@@ -603,14 +1080,20 @@ Font LoadFontEx(const char *path, int baseSize, int *codepoints, int codepointCo
     }
     f.baseSize = baseSize;
     f._ttf = tf;
+    g_live_fonts++;
     // Populate texture stub so any caller that pokes font.texture fields
     // gets sane zeros instead of garbage.
     f.texture.id = g_next_tex_id++;
     return f;
 }
 
+static void GlyphAtlasDropFont(TTF_Font *tf);
+
 void UnloadFont(Font font) {
-    if (font._ttf) TTF_CloseFont((TTF_Font*)font._ttf);
+    if (!font._ttf) return;
+    GlyphAtlasDropFont((TTF_Font*)font._ttf);
+    TTF_CloseFont((TTF_Font*)font._ttf);
+    g_live_fonts--;
 }
 
 // ---------------------------------------------------------------------------
@@ -621,27 +1104,41 @@ void UnloadFont(Font font) {
 // destroy) — that was the dominant frame cost in the SDL3 build, showing up
 // as low frame-time but high Activity-Monitor CPU and ever-growing RAM as
 // SDL3_ttf's internal glyph cache rebuilt on every TTF_SetFontSize call.
+// Most text now comes from the glyph atlases below; this cache serves the
+// lines they can't.
 //
-// Cache: 1024 open-addressed buckets, replace-on-collision (no probing). The
-// working set of ~50-80 unique (string, size, color) tuples per frame fits
-// well under the table's birthday-collision threshold; the few collisions
-// per second cost one rasterize, identical to the no-cache cost we're
-// replacing. Strings longer than TEXT_KEY_MAX bypass the cache (long
-// narration lines vary per page anyway, so caching wouldn't help).
+// Cache: open addressing with linear probing over TEXT_CACHE_SLOTS, keyed by
+// (text, size, rgba). Residency is bounded by a GPU-byte budget (w·h·4 per
+// texture, SetTextCacheBudget) and by TEXT_CACHE_MAX_LOAD entries to keep
+// probe chains short; inserting past either evicts least-recently-drawn
+// entries first. Entries drawn this frame are never evicted — if the frame
+// alone overflows the budget, the newcomer is drawn uncached instead.
+// Removal back-shifts the probe chain, so there are no tombstones. Strings
+// longer than TEXT_KEY_MAX bypass the cache (long narration lines vary per
+// page anyway, so caching wouldn't help).
 // ---------------------------------------------------------------------------
-#define TEXT_CACHE_BUCKETS 1024
-#define TEXT_KEY_MAX        80
+#define TEXT_CACHE_SLOTS          1024   // power of two
+#define TEXT_CACHE_MAX_LOAD       768
+#define TEXT_CACHE_BUDGET_DEFAULT ((size_t)8 << 20)
+#define TEXT_KEY_MAX              80
 
 typedef struct {
     char         text[TEXT_KEY_MAX];
     int          size;          // pixels (rounded)
     Uint32       rgba;          // packed tint
-    SDL_Texture *tex;
+    unsigned     hash;
+    SDL_Texture *tex;           // NULL = empty slot
     int          w, h;
     Uint64       lastUsedFrame;
 } TextCacheEntry;
 
-static TextCacheEntry sTextCache[TEXT_CACHE_BUCKETS];
+static TextCacheEntry sTextCache[TEXT_CACHE_SLOTS];
+static int            sTextCacheCount = 0;
+static size_t         sTextCacheBytes = 0;
+static size_t         sTextCacheBudget = TEXT_CACHE_BUDGET_DEFAULT;
+// Counters for the frame in progress, and the last completed frame's
+// snapshot that GetTextCacheStats reports (rolled over in EndDrawing).
+static TextCacheStats sTextStatsCur, sTextStatsLast;
 // Storage definition for sTextFrame — the forward decl up near CloseWindow
 // lets EndDrawing/CloseWindow reach this counter without re-ordering the
 // whole file.
@@ -657,13 +1154,76 @@ static unsigned TextCacheHash(const char *s, size_t len, int size, Uint32 rgba)
 }
 
 static void TextCacheClear(void) {
-    for (int i = 0; i < TEXT_CACHE_BUCKETS; i++) {
+    for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
         if (sTextCache[i].tex) {
-            SDL_DestroyTexture(sTextCache[i].tex);
+            DestroyTexture(sTextCache[i].tex);
             sTextCache[i].tex = NULL;
         }
         sTextCache[i].text[0] = '\0';
     }
+    sTextCacheCount = 0;
+    sTextCacheBytes = 0;
+}
+
+// Destroy slot i and back-shift the rest of its probe chain into the hole:
+// an entry may move back if its home bucket isn't cyclically in (hole, j].
+static void TextCacheRemove(unsigned i) {
+    TextCacheEntry *e = &sTextCache[i];
+    DestroyTexture(e->tex);
+    sTextCacheBytes -= (size_t)e->w * (size_t)e->h * 4;
+    sTextCacheCount--;
+    unsigned hole = i, j = i;
+    for (;;) {
+        j = (j + 1) & (TEXT_CACHE_SLOTS - 1);
+        if (!sTextCache[j].tex) break;
+        unsigned home = sTextCache[j].hash & (TEXT_CACHE_SLOTS - 1);
+        bool stays = (hole <= j) ? (home > hole && home <= j)
+                                 : (home > hole || home <= j);
+        if (!stays) {
+            sTextCache[hole] = sTextCache[j];
+            hole = j;
+        }
+    }
+    sTextCache[hole].tex = NULL;
+    sTextCache[hole].text[0] = '\0';
+}
+
+// Evict least-recently-drawn entries until `incoming` more bytes fit the
+// budget and a slot is free under the load cap. False if that would mean
+// evicting something drawn this frame.
+static bool TextCacheMakeRoom(size_t incoming) {
+    while (sTextCacheCount > 0 &&
+           (sTextCacheBytes + incoming > sTextCacheBudget ||
+            sTextCacheCount >= TEXT_CACHE_MAX_LOAD)) {
+        int lru = -1;
+        for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
+            if (sTextCache[i].tex &&
+                (lru < 0 || sTextCache[i].lastUsedFrame < sTextCache[lru].lastUsedFrame)) lru = i;
+        }
+        if (sTextCache[lru].lastUsedFrame >= sTextFrame) return false;
+        TextCacheRemove((unsigned)lru);
+        sTextStatsCur.evictions++;
+    }
+    return incoming <= sTextCacheBudget;
+}
+
+void SetTextCacheBudget(size_t bytes) {
+    sTextCacheBudget = bytes;
+    TextCacheMakeRoom(0);
+}
+
+TextCacheStats GetTextCacheStats(void) {
+    TextCacheStats st = sTextStatsLast;
+    st.entries       = sTextCacheCount;
+    st.bytesResident = sTextCacheBytes;
+    st.budgetBytes   = sTextCacheBudget;
+    return st;
+}
+
+// Called from EndDrawing: publish this frame's counters and start fresh.
+static void TextCacheEndFrame(void) {
+    sTextStatsLast = sTextStatsCur;
+    memset(&sTextStatsCur, 0, sizeof(sTextStatsCur));
 }
 
 // Track the font size SDL3_ttf is currently configured at. SetFontSize
@@ -676,15 +1236,243 @@ static void SetFontSizeIfNeeded(TTF_Font *tf, int size) {
     sCurFontSize = size;
 }
 
+// ---------------------------------------------------------------------------
+// Glyph atlases.
+//
+// The string cache above only pays off for strings that repeat verbatim.
+// Dialogue typewriter prefixes, battle narration and TextFormat'd HUD
+// numbers are new strings nearly every frame, and each one cost a
+// TTF_RenderText_Blended + texture upload + destroy. Instead, each
+// (font, pixel size) gets an atlas texture that glyphs are rasterized into
+// once, white, on first use; a line is then a run of textured quads in the
+// geometry batch, tinted through vertex colours. Cost scales with glyph
+// count, not with how many distinct strings were drawn.
+//
+// Pen advances and kerning pairs are cached beside the glyph rects, so
+// laying out or measuring a line never touches SDL3_ttf (and never forces
+// the TTF_SetFontSize cache rebuild) once its glyphs are resident.
+//
+// Coverage is Latin-1. A line with any other codepoint, a size above
+// GLYPH_MAX_PX (the title wordmark) or a glyph that no longer fits in a
+// full atlas falls back to the string cache, which draws it exactly as
+// before.
+// ---------------------------------------------------------------------------
+#define GLYPH_ATLAS_MAX   12     // live (font, size) atlases, LRU-recycled
+#define GLYPH_MAX_PX      96
+#define GLYPH_LAST        255    // highest codepoint held in an atlas
+#define GLYPH_PAD         1      // transparent texels around each glyph
+#define KERN_FIRST        32     // kerning is cached for printable ASCII
+#define KERN_LAST         126
+#define KERN_N            (KERN_LAST - KERN_FIRST + 1)
+#define KERN_UNKNOWN      (-128)
+
+typedef struct {
+    short x, y, w, h;        // atlas rect; w == 0 for blank glyphs (space)
+    short advance;
+    bool  ready;             // rasterized (or known blank)
+    bool  missing;           // font has no glyph / atlas was full
+} AtlasGlyph;
+
+typedef struct {
+    TTF_Font    *font;       // NULL = free slot
+    int          size;
+    SDL_Texture *tex;        // created lazily with the first visible glyph
+    int          side;
+    int          penX, penY, rowH;
+    int          lineSkip;
+    Uint64       lastUsedFrame;
+    AtlasGlyph   glyph[GLYPH_LAST + 1];
+    signed char  kern[KERN_N * KERN_N];
+} GlyphAtlas;
+
+static GlyphAtlas sGlyphAtlas[GLYPH_ATLAS_MAX];
+
+static void GlyphAtlasRelease(GlyphAtlas *a) {
+    if (a->tex) {
+        if (g_batch_tex == a->tex) { BatchFlush(); g_batch_tex = NULL; }
+        DestroyTexture(a->tex);
+    }
+    a->tex  = NULL;
+    a->font = NULL;
+}
+
+static void GlyphAtlasClear(void) {
+    for (int i = 0; i < GLYPH_ATLAS_MAX; i++) GlyphAtlasRelease(&sGlyphAtlas[i]);
+}
+
+// UnloadFont: a later TTF_OpenFont may hand back the same pointer.
+static void GlyphAtlasDropFont(TTF_Font *tf) {
+    for (int i = 0; i < GLYPH_ATLAS_MAX; i++) {
+        if (sGlyphAtlas[i].font == tf) GlyphAtlasRelease(&sGlyphAtlas[i]);
+    }
+}
+
+// Atlas for (tf, size), recycling the least recently drawn one when all
+// slots are taken. NULL for sizes the atlas path doesn't serve.
+static GlyphAtlas *GlyphAtlasFor(TTF_Font *tf, int size) {
+    if (size < 1 || size > GLYPH_MAX_PX) return NULL;
+    GlyphAtlas *victim = NULL;
+    for (int i = 0; i < GLYPH_ATLAS_MAX; i++) {
+        GlyphAtlas *a = &sGlyphAtlas[i];
+        if (a->font == tf && a->size == size) {
+            a->lastUsedFrame = sTextFrame;
+            return a;
+        }
+        if (!victim || !a->font ||
+            (victim->font && a->lastUsedFrame < victim->lastUsedFrame)) victim = a;
+    }
+    GlyphAtlasRelease(victim);
+    memset(victim, 0, sizeof(*victim));
+    victim->font = tf;
+    victim->size = size;
+    // ~100 glyph cells of roughly 0.6em x 1.2em fit in a (10·size)² square.
+    victim->side = 128;
+    while (victim->side < size * 10 && victim->side < 1024) victim->side *= 2;
+    memset(victim->kern, KERN_UNKNOWN, sizeof(victim->kern));
+    SetFontSizeIfNeeded(tf, size);
+    victim->lineSkip = TTF_GetFontLineSkip(tf);
+    if (victim->lineSkip <= 0) victim->lineSkip = size;
+    victim->lastUsedFrame = sTextFrame;
+    return victim;
+}
+
+// Rasterize `cp` into the atlas if it isn't there yet. Returns NULL when
+// the glyph can't be served from the atlas.
+static const AtlasGlyph *GlyphGet(GlyphAtlas *a, Uint32 cp) {
+    if (cp > GLYPH_LAST) return NULL;
+    AtlasGlyph *g = &a->glyph[cp];
+    if (g->ready) return g->missing ? NULL : g;
+    g->ready = true;
+
+    SetFontSizeIfNeeded(a->font, a->size);
+    int minx, maxx, miny, maxy, advance;
+    if (!TTF_FontHasGlyph(a->font, cp) ||
+        !TTF_GetGlyphMetrics(a->font, cp, &minx, &maxx, &miny, &maxy, &advance)) {
+        g->missing = true;
+        return NULL;
+    }
+    g->advance = (short)advance;
+    if (cp == ' ' || maxx <= minx) return g;   // blank: advance only
+
+    ZONE_BEGIN("GlyphRasterize");
+    SDL_Surface *raw = TTF_RenderGlyph_Blended(a->font, cp, (SDL_Color){255, 255, 255, 255});
+    SDL_Surface *surf = raw ? SDL_ConvertSurface(raw, SDL_PIXELFORMAT_RGBA32) : NULL;
+    if (raw) SDL_DestroySurface(raw);
+    ZONE_END();
+    if (!surf) { g->missing = true; return NULL; }
+
+    // Shelf-pack. A full atlas isn't repacked: the glyphs already in it
+    // stay valid, and the few lines needing a newcomer use the string cache.
+    int w = surf->w + GLYPH_PAD, h = surf->h + GLYPH_PAD;
+    if (a->penX + w > a->side) {
+        a->penX = 0;
+        a->penY += a->rowH;
+        a->rowH = 0;
+    }
+    if (a->penY + h > a->side) {
+        SDL_DestroySurface(surf);
+        g->missing = true;
+        return NULL;
+    }
+    if (!a->tex) {
+        a->tex = SDL_CreateTexture(g_renderer, SDL_PIXELFORMAT_RGBA32,
+                                   SDL_TEXTUREACCESS_STATIC, a->side, a->side);
+        if (a->tex) CreatedTexture(a->tex);
+        void *zero = a->tex ? calloc((size_t)a->side * (size_t)a->side, 4) : NULL;
+        if (!zero) {
+            if (a->tex) { DestroyTexture(a->tex); a->tex = NULL; }
+            SDL_DestroySurface(surf);
+            g->missing = true;
+            return NULL;
+        }
+        SDL_UpdateTexture(a->tex, NULL, zero, a->side * 4);
+        free(zero);
+        SDL_SetTextureBlendMode(a->tex, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(a->tex, SDL_SCALEMODE_LINEAR);
+    }
+    SDL_Rect dst = { a->penX, a->penY, surf->w, surf->h };
+    SDL_UpdateTexture(a->tex, &dst, surf->pixels, surf->pitch);
+    g->x = (short)dst.x; g->y = (short)dst.y;
+    g->w = (short)dst.w; g->h = (short)dst.h;
+    a->penX += w;
+    if (h > a->rowH) a->rowH = h;
+    SDL_DestroySurface(surf);
+    return g;
+}
+
+static int GlyphKern(GlyphAtlas *a, Uint32 prev, Uint32 cp) {
+    if (prev < KERN_FIRST || prev > KERN_LAST || cp < KERN_FIRST || cp > KERN_LAST) return 0;
+    signed char *k = &a->kern[(prev - KERN_FIRST) * KERN_N + (cp - KERN_FIRST)];
+    if (*k == KERN_UNKNOWN) {
+        int kern = 0;
+        SetFontSizeIfNeeded(a->font, a->size);
+        if (!TTF_GetGlyphKerning(a->font, prev, cp, &kern)) kern = 0;
+        if (kern < -127) kern = -127;
+        if (kern >  127) kern =  127;
+        *k = (signed char)kern;
+    }
+    return *k;
+}
+
+// Lay out one line from the atlas: rasterizes missing glyphs, and when
+// `draw` is set appends the glyph quads to the batch. Returns false (having
+// emitted nothing) if any glyph can't come from the atlas.
+static bool GlyphLine(GlyphAtlas *a, const char *line, size_t length, bool draw,
+                      float x, float y, SDL_Color c, int *widthOut) {
+    // Pass 1: make every glyph resident, so a fallback never leaves half a
+    // line in the batch.
+    const char *p = line;
+    size_t left = length;
+    while (left > 0) {
+        Uint32 cp = SDL_StepUTF8(&p, &left);
+        if (!GlyphGet(a, cp)) return false;
+    }
+
+    SDL_FColor fc = { c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
+    float inv = 1.0f / (float)a->side;
+    int pen = 0;
+    Uint32 prev = 0;
+    p = line;
+    left = length;
+    while (left > 0) {
+        Uint32 cp = SDL_StepUTF8(&p, &left);
+        const AtlasGlyph *g = &a->glyph[cp];
+        pen += GlyphKern(a, prev, cp);
+        prev = cp;
+        if (draw && g->w > 0) {
+            int *idx, base;
+            SDL_Vertex *v = BatchAllocTex(a->tex, 4, 6, &idx, &base);
+            if (v) {
+                // Whole-pixel origin keeps linear filtering from softening
+                // the glyph edges.
+                float x0 = floorf(x + 0.5f) + (float)pen, y0 = floorf(y + 0.5f);
+                float x1 = x0 + (float)g->w, y1 = y0 + (float)g->h;
+                float u0 = g->x * inv, v0 = g->y * inv;
+                float u1 = (g->x + g->w) * inv, v1 = (g->y + g->h) * inv;
+                v[0] = (SDL_Vertex){ { x0, y0 }, fc, { u0, v0 } };
+                v[1] = (SDL_Vertex){ { x1, y0 }, fc, { u1, v0 } };
+                v[2] = (SDL_Vertex){ { x1, y1 }, fc, { u1, v1 } };
+                v[3] = (SDL_Vertex){ { x0, y1 }, fc, { u0, v1 } };
+                idx[0] = base; idx[1] = base + 1; idx[2] = base + 2;
+                idx[3] = base; idx[4] = base + 2; idx[5] = base + 3;
+            }
+        }
+        pen += g->advance;
+    }
+    if (widthOut) *widthOut = pen;
+    return true;
+}
+
 // Render a single line (no embedded newlines). Caller handles the line-by-line
 // layout — SDL3_ttf otherwise renders '\n' as a .notdef glyph (visible squares).
 //
-// Cached: hash (text, size, rgba) into the bucket table; reuse the texture
-// across frames. Replace-on-collision keeps the table O(1) and doesn't need
-// LRU bookkeeping for our access pattern.
-static void DrawTextLineSDL(TTF_Font *tf, const char *line, size_t length,
+// Glyph atlas first (`a` may be NULL). Otherwise the string cache: probe for
+// (text, size, rgba) and reuse the texture across frames, rasterizing and
+// inserting (under the byte budget) on a miss.
+static void DrawTextLineSDL(TTF_Font *tf, GlyphAtlas *a, const char *line, size_t length,
                             int sizePx, float screenX, float screenY, SDL_Color c) {
     if (length == 0) return;
+    if (a && GlyphLine(a, line, length, true, screenX, screenY, c, NULL)) return;
 
     Uint32 rgba = ((Uint32)c.r << 24) | ((Uint32)c.g << 16)
                 | ((Uint32)c.b <<  8) |  (Uint32)c.a;
@@ -693,44 +1481,63 @@ static void DrawTextLineSDL(TTF_Font *tf, const char *line, size_t length,
     int texW = 0, texH = 0;
 
     bool cacheable = (length < TEXT_KEY_MAX);
-    unsigned bucket = 0;
+    unsigned hash = 0, slot = 0;
     if (cacheable) {
-        bucket = TextCacheHash(line, length, sizePx, rgba) % TEXT_CACHE_BUCKETS;
-        TextCacheEntry *e = &sTextCache[bucket];
-        if (e->tex && e->size == sizePx && e->rgba == rgba
-            && strncmp(e->text, line, length) == 0
-            && e->text[length] == '\0') {
-            // Hit.
-            tex = e->tex;
-            texW = e->w; texH = e->h;
-            e->lastUsedFrame = sTextFrame;
+        hash = TextCacheHash(line, length, sizePx, rgba);
+        for (slot = hash & (TEXT_CACHE_SLOTS - 1); sTextCache[slot].tex;
+             slot = (slot + 1) & (TEXT_CACHE_SLOTS - 1)) {
+            TextCacheEntry *e = &sTextCache[slot];
+            if (e->hash == hash && e->size == sizePx && e->rgba == rgba
+                && strncmp(e->text, line, length) == 0
+                && e->text[length] == '\0') {
+                tex = e->tex;
+                texW = e->w; texH = e->h;
+                e->lastUsedFrame = sTextFrame;
+                sTextStatsCur.hits++;
+                break;
+            }
         }
     }
 
     if (!tex) {
         SetFontSizeIfNeeded(tf, sizePx);
+        ZONE_BEGIN("TextRasterize");
         SDL_Surface *surf = TTF_RenderText_Blended(tf, line, length, c);
-        if (!surf) return;
+        if (!surf) { ZONE_END(); return; }
         tex = SDL_CreateTextureFromSurface(g_renderer, surf);
         texW = surf->w; texH = surf->h;
         SDL_DestroySurface(surf);
+        ZONE_END();
         if (!tex) return;
-
-        if (cacheable) {
-            TextCacheEntry *e = &sTextCache[bucket];
-            if (e->tex) SDL_DestroyTexture(e->tex);
+        CreatedTexture(tex);
+        if (cacheable) sTextStatsCur.misses++;
+
+        size_t bytes = (size_t)texW * (size_t)texH * 4;
+        if (cacheable && TextCacheMakeRoom(bytes)) {
+            // Eviction may have back-shifted the chain; re-probe for the
+            // first free slot.
+            for (slot = hash & (TEXT_CACHE_SLOTS - 1); sTextCache[slot].tex;
+                 slot = (slot + 1) & (TEXT_CACHE_SLOTS - 1)) {}
+            TextCacheEntry *e = &sTextCache[slot];
             memcpy(e->text, line, length);
             e->text[length] = '\0';
-            e->size = sizePx; e->rgba = rgba;
+            e->size = sizePx; e->rgba = rgba; e->hash = hash;
             e->tex = tex; e->w = texW; e->h = texH;
             e->lastUsedFrame = sTextFrame;
+            sTextCacheCount++;
+            sTextCacheBytes += bytes;
+        } else {
+            cacheable = false;   // drawn once below, then destroyed
         }
     }
 
     SDL_FRect dst = { screenX, screenY, (float)texW, (float)texH };
-    SDL_RenderTexture(g_renderer, tex, NULL, &dst);
+    BatchFlush();
+    STAT_ADD(textureBlits, 1);
+    STAT_BIND(tex);
+    if (!NullSubmit()) SDL_RenderTexture(g_renderer, tex, NULL, &dst);
 
-    if (!cacheable) SDL_DestroyTexture(tex);
+    if (!cacheable) DestroyTexture(tex);
 }
 
 void DrawTextEx(Font font, const char *text, Vector2 position,
@@ -742,21 +1549,28 @@ void DrawTextEx(Font font, const char *text, Vector2 position,
     float renderSize = XformLen(fontSize);
     if (renderSize < 1.0f) return;
     int sizePx = (int)(renderSize + 0.5f);
-    SetFontSizeIfNeeded(tf, sizePx);
     SDL_Color c = { tint.r, tint.g, tint.b, tint.a };
     float px = position.x, py = position.y;
     XformPoint(&px, &py);
 
     // Walk the string, drawing each \n-delimited line at an incrementing Y.
-    // TTF_GetFontLineSkip gives the recommended vertical advance.
-    int lineSkip = TTF_GetFontLineSkip(tf);
+    // TTF_GetFontLineSkip gives the recommended vertical advance (cached on
+    // the glyph atlas so the common path never switches the font size).
+    GlyphAtlas *a = GlyphAtlasFor(tf, sizePx);
+    int lineSkip;
+    if (a) {
+        lineSkip = a->lineSkip;
+    } else {
+        SetFontSizeIfNeeded(tf, sizePx);
+        lineSkip = TTF_GetFontLineSkip(tf);
+    }
     if (lineSkip <= 0) lineSkip = sizePx;
     const char *seg = text;
     float y = py;
     for (;;) {
         const char *nl = strchr(seg, '\n');
         size_t segLen = nl ? (size_t)(nl - seg) : strlen(seg);
-        DrawTextLineSDL(tf, seg, segLen, sizePx, px, y, c);
+        DrawTextLineSDL(tf, a, seg, segLen, sizePx, px, y, c);
         if (!nl) break;
         seg = nl + 1;
         y += (float)lineSkip;
@@ -768,10 +1582,18 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
     Vector2 v = {0, 0};
     TTF_Font *tf = (TTF_Font*)font._ttf;
     if (!tf || !text) return v;
-    SetFontSizeIfNeeded(tf, (int)(fontSize + 0.5f));
+    int sizePx = (int)(fontSize + 0.5f);
     // Per-line max width + cumulative height. Skip newline characters so they
-    // don't get measured as glyphs.
-    int lineSkip = TTF_GetFontLineSkip(tf);
+    // don't get measured as glyphs. Widths come from the glyph atlas's cached
+    // advances + kerning — the same layout DrawTextEx draws with.
+    GlyphAtlas *a = GlyphAtlasFor(tf, sizePx);
+    int lineSkip;
+    if (a) {
+        lineSkip = a->lineSkip;
+    } else {
+        SetFontSizeIfNeeded(tf, sizePx);
+        lineSkip = TTF_GetFontLineSkip(tf);
+    }
     if (lineSkip <= 0) lineSkip = (int)fontSize;
     const char *seg = text;
     int maxW = 0;
@@ -780,7 +1602,11 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
         const char *nl = strchr(seg, '\n');
         size_t segLen = nl ? (size_t)(nl - seg) : strlen(seg);
         int w = 0, h = 0;
-        if (segLen > 0) TTF_GetStringSize(tf, seg, segLen, &w, &h);
+        if (segLen > 0 && !(a && GlyphLine(a, seg, segLen, false, 0, 0,
+                                           (SDL_Color){0, 0, 0, 0}, &w))) {
+            SetFontSizeIfNeeded(tf, sizePx);
+            TTF_GetStringSize(tf, seg, segLen, &w, &h);
+        }
         if (w > maxW) maxW = w;
         lines++;
         if (!nl) break;
@@ -903,24 +1729,30 @@ Color ColorAlpha(Color c, float alpha) {
 void DrawPixel(int x, int y, Color c) {
     float fx = (float)x, fy = (float)y;
     XformPoint(&fx, &fy);
+    BatchFlush();
     SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
-    SDL_RenderPoint(g_renderer, fx, fy);
+    STAT_ADD(lineCalls, 1);
+    if (!NullSubmit()) SDL_RenderPoint(g_renderer, fx, fy);
 }
 
 void DrawLine(int sx, int sy, int ex, int ey, Color c) {
     float fsx = (float)sx, fsy = (float)sy, fex = (float)ex, fey = (float)ey;
     XformPoint(&fsx, &fsy);
     XformPoint(&fex, &fey);
+    BatchFlush();
     SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
-    SDL_RenderLine(g_renderer, fsx, fsy, fex, fey);
+    STAT_ADD(lineCalls, 1);
+    if (!NullSubmit()) SDL_RenderLine(g_renderer, fsx, fsy, fex, fey);
 }
 
 void DrawRectangleLines(int x, int y, int w, int h, Color c) {
     float fx = (float)x, fy = (float)y;
     XformPoint(&fx, &fy);
+    BatchFlush();
     SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
     SDL_FRect r = { fx, fy, XformLen((float)w), XformLen((float)h) };
-    SDL_RenderRect(g_renderer, &r);
+    STAT_ADD(lineCalls, 1);
+    if (!NullSubmit()) SDL_RenderRect(g_renderer, &r);
 }
 
 // Triangle-fan / capped-rect builder used by the rounded-rect helpers.
@@ -941,13 +1773,19 @@ static void EmitRoundedRectFilled(Rectangle r, float roundness, int segments, Co
     float rw = XformLen(r.width);
     float rh = XformLen(r.height);
     float radius = roundness * 0.5f * (rw < rh ? rw : rh);
+    // Honour the caller's per-corner detail but never exceed what the
+    // on-screen radius can show — sprite bodies ask for 14 on a 10 px corner.
+    int lod = TessSegments(radius) / 4;
+    if (segments > lod) segments = lod;
     if (segments < 2) segments = 2;
+    const SDL_FPoint *arc = TessArc(segments);
 
-    SDL_FColor fc = { c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
+    SDL_FColor fc = ToFColor(c);
     // Center vertex + 4 corners × (segments+1) vertices each. Build a fan.
     int total = 1 + 4 * (segments + 1);
-    SDL_Vertex *v = (SDL_Vertex*)malloc(sizeof(SDL_Vertex) * total);
-    int *idx = (int*)malloc(sizeof(int) * (total - 1) * 3);
+    int *idx, base;
+    SDL_Vertex *v = BatchAlloc(total, (total - 1) * 3, &idx, &base);
+    if (!v) return;
 
     float cx = rx + rw * 0.5f;
     float cy = ry + rh * 0.5f;
@@ -960,28 +1798,24 @@ static void EmitRoundedRectFilled(Rectangle r, float roundness, int segments, Co
     const float ccy[4] = { ry + radius,      ry + rh - radius, ry + rh - radius, ry + radius      };
     int vi = 1;
     for (int corner = 0; corner < 4; corner++) {
-        float a0 = -1.5707963f + (float)corner * 1.5707963f;  // -π/2 + corner·π/2
         for (int s = 0; s <= segments; s++) {
-            float a = a0 + (1.5707963f * (float)s / (float)segments);
-            v[vi].position = (SDL_FPoint){ ccx[corner] + cosf(a) * radius,
-                                            ccy[corner] + sinf(a) * radius };
+            SDL_FPoint u = TessCorner(arc, corner, s);
+            v[vi].position = (SDL_FPoint){ ccx[corner] + u.x * radius,
+                                            ccy[corner] + u.y * radius };
             v[vi].color = fc;
             v[vi].tex_coord = (SDL_FPoint){0,0};
             vi++;
         }
     }
     for (int i = 1; i < total - 1; i++) {
-        idx[(i-1)*3 + 0] = 0;
-        idx[(i-1)*3 + 1] = i;
-        idx[(i-1)*3 + 2] = i + 1;
+        idx[(i-1)*3 + 0] = base;
+        idx[(i-1)*3 + 1] = base + i;
+        idx[(i-1)*3 + 2] = base + i + 1;
     }
     // Close the loop back to the first perimeter vertex.
-    idx[(total - 2)*3 + 0] = 0;
-    idx[(total - 2)*3 + 1] = total - 1;
-    idx[(total - 2)*3 + 2] = 1;
-    SDL_RenderGeometry(g_renderer, NULL, v, total, idx, (total - 1) * 3);
-    free(v);
-    free(idx);
+    idx[(total - 2)*3 + 0] = base;
+    idx[(total - 2)*3 + 1] = base + total - 1;
+    idx[(total - 2)*3 + 2] = base + 1;
 }
 
 void DrawRectangleRounded(Rectangle r, float roundness, int segments, Color c) {
@@ -999,7 +1833,10 @@ void DrawRectangleRoundedLinesEx(Rectangle r, float roundness, int segments,
     }
     if (roundness > 1.0f) roundness = 1.0f;
     float radius = roundness * 0.5f * (r.width < r.height ? r.width : r.height);
+    int lod = TessSegments(XformLen(radius)) / 4;
+    if (segments > lod) segments = lod;
     if (segments < 2) segments = 2;
+    const SDL_FPoint *arc = TessArc(segments);
 
     const float ccx[4] = { r.x + r.width  - radius, r.x + r.width  - radius, r.x + radius,            r.x + radius            };
     const float ccy[4] = { r.y + radius,            r.y + r.height - radius, r.y + r.height - radius, r.y + radius            };
@@ -1007,12 +1844,12 @@ void DrawRectangleRoundedLinesEx(Rectangle r, float roundness, int segments,
     // Arcs.
     Vector2 arcEnds[4][2];
     for (int corner = 0; corner < 4; corner++) {
-        float a0 = -1.5707963f + (float)corner * 1.5707963f;
-        Vector2 prev = { ccx[corner] + cosf(a0) * radius, ccy[corner] + sinf(a0) * radius };
+        SDL_FPoint u0 = TessCorner(arc, corner, 0);
+        Vector2 prev = { ccx[corner] + u0.x * radius, ccy[corner] + u0.y * radius };
         arcEnds[corner][0] = prev;
         for (int s = 1; s <= segments; s++) {
-            float a = a0 + (1.5707963f * (float)s / (float)segments);
-            Vector2 p = { ccx[corner] + cosf(a) * radius, ccy[corner] + sinf(a) * radius };
+            SDL_FPoint u = TessCorner(arc, corner, s);
+            Vector2 p = { ccx[corner] + u.x * radius, ccy[corner] + u.y * radius };
             DrawLineEx(prev, p, thickness, c);
             prev = p;
         }
@@ -1037,15 +1874,16 @@ void DrawCircleLines(int cx, int cy, float radius, Color c) {
     float fcx = (float)cx, fcy = (float)cy;
     XformPoint(&fcx, &fcy);
     float r = XformLen(radius);
-    int segments = (int)(r * 0.6f);
-    if (segments < 12) segments = 12;
-    if (segments > 64) segments = 64;
+    int segments = TessSegments(r);
+    const SDL_FPoint *unit = TessCircle(segments);
+    BatchFlush();
+    STAT_ADD(lineCalls, segments);
+    if (NullSubmit()) return;
     SDL_SetRenderDrawColor(g_renderer, c.r, c.g, c.b, c.a);
     float prevX = fcx + r, prevY = fcy;
     for (int i = 1; i <= segments; i++) {
-        float a = (float)i / (float)segments * 6.28318530718f;
-        float x = fcx + cosf(a) * r;
-        float y = fcy + sinf(a) * r;
+        float x = fcx + unit[i].x * r;
+        float y = fcy + unit[i].y * r;
         SDL_RenderLine(g_renderer, prevX, prevY, x, y);
         prevX = x; prevY = y;
     }
@@ -1055,41 +1893,53 @@ void DrawEllipse(int cx, int cy, float rx, float ry, Color c) {
     float fcx = (float)cx, fcy = (float)cy;
     XformPoint(&fcx, &fcy);
     float frx = XformLen(rx), fry = XformLen(ry);
-    int segments = (int)((frx + fry) * 0.4f);
-    if (segments < 16) segments = 16;
-    if (segments > 64) segments = 64;
-    SDL_FColor fc = { c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
-    SDL_Vertex *v = (SDL_Vertex*)malloc(sizeof(SDL_Vertex) * (segments + 1));
-    int *idx = (int*)malloc(sizeof(int) * segments * 3);
-    v[0].position = (SDL_FPoint){ fcx, fcy };
-    v[0].color = fc;
-    v[0].tex_coord = (SDL_FPoint){0,0};
+    int segments = TessSegments(frx > fry ? frx : fry);
+    const SDL_FPoint *unit = TessCircle(segments);
+    SDL_FColor fc = ToFColor(c);
+    int *idx, base;
+    SDL_Vertex *v = BatchAlloc(segments + 1, segments * 3, &idx, &base);
+    if (!v) return;
+    v[0] = (SDL_Vertex){ { fcx, fcy }, fc, {0,0} };
     for (int i = 0; i < segments; i++) {
-        float a = (float)i / (float)segments * 6.28318530718f;
-        v[i+1].position = (SDL_FPoint){ fcx + cosf(a) * frx, fcy + sinf(a) * fry };
-        v[i+1].color = fc;
-        v[i+1].tex_coord = (SDL_FPoint){0,0};
-        idx[i*3 + 0] = 0;
-        idx[i*3 + 1] = i + 1;
-        idx[i*3 + 2] = (i + 1) % segments + 1;
+        v[i+1] = (SDL_Vertex){ { fcx + unit[i].x * frx, fcy + unit[i].y * fry }, fc, {0,0} };
+        idx[i*3 + 0] = base;
+        idx[i*3 + 1] = base + i + 1;
+        idx[i*3 + 2] = base + (i + 1) % segments + 1;
     }
-    SDL_RenderGeometry(g_renderer, NULL, v, segments + 1, idx, segments * 3);
-    free(v);
-    free(idx);
 }
 
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color c) {
     XformPoint(&v1.x, &v1.y);
     XformPoint(&v2.x, &v2.y);
     XformPoint(&v3.x, &v3.y);
-    SDL_FColor fc = { c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
-    SDL_Vertex v[3] = {
-        { { v1.x, v1.y }, fc, {0,0} },
-        { { v2.x, v2.y }, fc, {0,0} },
-        { { v3.x, v3.y }, fc, {0,0} },
-    };
-    int idx[3] = { 0, 1, 2 };
-    SDL_RenderGeometry(g_renderer, NULL, v, 3, idx, 3);
+    SDL_FColor fc = ToFColor(c);
+    int *idx, base;
+    SDL_Vertex *v = BatchAlloc(3, 3, &idx, &base);
+    if (!v) return;
+    v[0] = (SDL_Vertex){ { v1.x, v1.y }, fc, {0,0} };
+    v[1] = (SDL_Vertex){ { v2.x, v2.y }, fc, {0,0} };
+    v[2] = (SDL_Vertex){ { v3.x, v3.y }, fc, {0,0} };
+    idx[0] = base; idx[1] = base + 1; idx[2] = base + 2;
+}
+
+// raylib semantics: triangle i uses points (i, i+1, i+2). Winding alternates
+// along the strip, which SDL doesn't care about (no face culling).
+void DrawTriangleStrip(const Vector2 *points, int pointCount, Color c) {
+    if (pointCount < 3) return;
+    SDL_FColor fc = ToFColor(c);
+    int *idx, base;
+    SDL_Vertex *v = BatchAlloc(pointCount, (pointCount - 2) * 3, &idx, &base);
+    if (!v) return;
+    for (int i = 0; i < pointCount; i++) {
+        float x = points[i].x, y = points[i].y;
+        XformPoint(&x, &y);
+        v[i] = (SDL_Vertex){ { x, y }, fc, {0,0} };
+    }
+    for (int i = 0; i < pointCount - 2; i++) {
+        idx[i*3 + 0] = base + i;
+        idx[i*3 + 1] = base + i + 1;
+        idx[i*3 + 2] = base + i + 2;
+    }
 }
 
 // ---------------------------------------------------------------------------
@@ -1148,19 +1998,23 @@ void BeginBlendMode(int mode) {
         case BLEND_ALPHA_PREMULTIPLY:  bm = SDL_BLENDMODE_BLEND_PREMULTIPLIED; break;
         default:                       bm = SDL_BLENDMODE_BLEND; break;
     }
+    BatchFlush();
     SDL_SetRenderDrawBlendMode(g_renderer, bm);
 }
 
 void EndBlendMode(void) {
+    BatchFlush();
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_BLEND);
 }
 
 void BeginScissorMode(int x, int y, int width, int height) {
+    BatchFlush();
     SDL_Rect r = { x, y, width, height };
     SDL_SetRenderClipRect(g_renderer, &r);
 }
 
 void EndScissorMode(void) {
+    BatchFlush();
     SDL_SetRenderClipRect(g_renderer, NULL);
 }
 
@@ -1248,9 +2102,15 @@ unsigned int TextLength(const char *text) {
 // Random
 // ---------------------------------------------------------------------------
 
+static bool g_rand_seeded = false;
+
+void SetRandomSeed(unsigned int seed) {
+    srand(seed);
+    g_rand_seeded = true;
+}
+
 int GetRandomValue(int min, int max) {
-    static bool seeded = false;
-    if (!seeded) { srand((unsigned)time(NULL)); seeded = true; }
+    if (!g_rand_seeded) SetRandomSeed((unsigned)time(NULL));
     if (max < min) { int t = min; min = max; max = t; }
     return min + rand() % (max - min + 1);
 }
@@ -1278,3 +2138,22 @@ bool IsGestureDetected(unsigned int gesture) {
     }
     return false;
 }
+
+// ---------------------------------------------------------------------------
+// Memory residency (soak runs)
+// ---------------------------------------------------------------------------
+
+ShimMemoryStats GetShimMemoryStats(void) {
+    ShimMemoryStats st = {0};
+    st.liveTextures     = g_live_textures;
+    st.liveTextureBytes = g_live_texture_bytes;
+    st.liveFonts        = g_live_fonts;
+    st.textCacheEntries = sTextCacheCount;
+    st.textCacheBytes   = sTextCacheBytes;
+    for (int i = 0; i < GLYPH_ATLAS_MAX; i++) {
+        if (sGlyphAtlas[i].tex) st.glyphAtlases++;
+    }
+    st.batchBytes = (size_t)g_batch_cap_v * sizeof(SDL_Vertex) +
+                    (size_t)g_batch_cap_i * sizeof(*g_batch_i);
+    return st;
+}
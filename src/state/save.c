@@ -3,8 +3,11 @@
 #include "../battle/combatant.h"
 #include "../battle/battle_grid.h"
 #include "../data/creature_defs.h"
+#include "../systems/replay.h"
+#include "../systems/trace.h"
 #include "raylib.h"
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
 #if defined(PLATFORM_WEB)
@@ -12,10 +15,11 @@
     // IDBFS is mounted at /save by the shell's preRun (see minshell.html) and
     // populated from IndexedDB before main() runs. Writes land in MEMFS first;
     // FS.syncfs(false, ...) flushes them back to IDB so they survive a reload.
-    #define SAVE_PATH "/save/savegame.dat"
+    #define SAVE_DIR "/save/"
 #else
-    #define SAVE_PATH "savegame.dat"
+    #define SAVE_DIR ""
 #endif
+#define SAVE_PATH SAVE_DIR "savegame.dat"
 #define SAVE_MAGIC   0x504B5044u  // 'D','P','K','P' little-endian
 // Bumped 3 → 4 (2026-05-04): SaveData now carries the `difficulty` field.
 // Bumped 4 → 5 (2026-05-05): added `rescueResumeFloor` for easy-mode dungeon resume.
@@ -124,7 +128,13 @@ static void UnpackCombatant(Combatant *c, const CombatantSave *in)
     }
 }
 
-bool SaveGame(const GameState *gs, int playerTileX, int playerTileY, int playerDir)
+int SaveSnapshotSize(void)
+{
+    return (int)sizeof(SaveData);
+}
+
+void SaveGameSnapshot(const GameState *gs, int playerTileX, int playerTileY, int playerDir,
+                      void *out)
 {
     SaveData s;
     memset(&s, 0, sizeof(s));
@@ -150,8 +160,19 @@ bool SaveGame(const GameState *gs, int playerTileX, int playerTileY, int playerD
         s.preferredCell[i] = gs->party.preferredCell[i];
     }
     s.inventory = gs->party.inventory;
+    memcpy(out, &s, sizeof(s));
+}
 
-    bool ok = SaveFileData(SAVE_PATH, &s, (int)sizeof(s));
+bool SaveGame(const GameState *gs, int playerTileX, int playerTileY, int playerDir)
+{
+    TraceBegin("SaveGame");
+    SaveData s;
+    SaveGameSnapshot(gs, playerTileX, playerTileY, playerDir, &s);
+
+    // A replay must not clobber the player's real save; it still pays for
+    // the snapshot so the workload matches the recorded run.
+    bool ok = ReplayPlaying() || SaveFileData(SAVE_PATH, &s, (int)sizeof(s));
+    ReplayNoteSave();
 #if defined(PLATFORM_WEB)
     // Push MEMFS→IDB so the save survives a page reload. Async; we fire and
     // forget — the next Load pulls from IDB on startup via preRun.
@@ -163,6 +184,7 @@ bool SaveGame(const GameState *gs, int playerTileX, int playerTileY, int playerD
         );
     }
 #endif
+    TraceEnd();
     return ok;
 }
 
@@ -173,14 +195,18 @@ bool LoadGame(GameState *gs, int *outPlayerX, int *outPlayerY, int *outPlayerDir
     int bytesRead = 0;
     unsigned char *raw = LoadFileData(SAVE_PATH, &bytesRead);
     if (!raw) return false;
-    if (bytesRead != (int)sizeof(SaveData)) {
-        UnloadFileData(raw);
-        return false;
-    }
+    bool ok = LoadGameSnapshot(gs, raw, bytesRead, outPlayerX, outPlayerY, outPlayerDir);
+    UnloadFileData(raw);
+    return ok;
+}
+
+bool LoadGameSnapshot(GameState *gs, const void *data, int size,
+                      int *outPlayerX, int *outPlayerY, int *outPlayerDir)
+{
+    if (size != (int)sizeof(SaveData)) return false;
 
     SaveData s;
-    memcpy(&s, raw, sizeof(s));
-    UnloadFileData(raw);
+    memcpy(&s, data, sizeof(s));
 
     if (s.magic != SAVE_MAGIC || s.version != SAVE_VERSION) return false;
 
@@ -216,5 +242,14 @@ bool LoadGame(GameState *gs, int *outPlayerX, int *outPlayerY, int *outPlayerDir
 
 bool SaveGameExists(void)
 {
+    bool exists;
+    if (ReplaySaveExists(&exists)) return exists;
     return FileExists(SAVE_PATH);
 }
+
+const char *SaveSiblingPath(const char *fileName)
+{
+    static char path[256];
+    snprintf(path, sizeof(path), "%s%s", SAVE_DIR, fileName);
+    return path;
+}
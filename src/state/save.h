@@ -26,4 +26,17 @@ bool SaveGame(const GameState *gs, int playerTileX, int playerTileY, int playerD
 bool LoadGame(GameState *gs, int *outPlayerX, int *outPlayerY, int *outPlayerDir);
 bool SaveGameExists(void);
 
+// The same record as an in-memory blob, for replays that need to carry the
+// starting state with them. `out` must hold SaveSnapshotSize() bytes.
+int  SaveSnapshotSize(void);
+void SaveGameSnapshot(const GameState *gs, int playerTileX, int playerTileY, int playerDir,
+                      void *out);
+bool LoadGameSnapshot(GameState *gs, const void *data, int size,
+                      int *outPlayerX, int *outPlayerY, int *outPlayerDir);
+
+// Path for another file kept beside savegame.dat (session metrics and other
+// dumps), so it lands in the same persistent directory on every platform.
+// Returns a static buffer, valid until the next call.
+const char *SaveSiblingPath(const char *fileName);
+
 #endif // SAVE_H
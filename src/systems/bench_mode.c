@@ -0,0 +1,150 @@
+#include "bench_mode.h"
+#include "raylib.h"
+#include "../field/field.h"
+#include "../state/game_state.h"
+#include "../battle/inventory.h"
+#include "../data/armor_defs.h"
+#include "../data/creature_defs.h"
+#include "../data/item_defs.h"
+#include "../data/move_defs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_RNG_SEED   0xB3C4u
+#define BENCH_PROC_FLOOR 3
+#define BENCH_PROC_SEED  0x5EEDu
+#define BENCH_PARTY_LVL  10
+
+static const char *kScenarioNames[BENCH_SCENARIO_COUNT] = {
+    "", "hub", "proc", "captain", "inventory",
+};
+
+static struct {
+    BenchScenario scenario;
+    int           frames;       // measured frames wanted
+    int           seen;         // frames presented so far, warm-up included
+    float        *ms;           // [frames]
+    int           count;
+    double        last;
+} gBench;
+
+bool BenchModeStart(const char *scenario, int frames)
+{
+    for (int s = BENCH_NONE + 1; s < BENCH_SCENARIO_COUNT; s++) {
+        if (strcmp(scenario, kScenarioNames[s]) != 0) continue;
+        gBench.frames   = frames > 0 ? frames : BENCH_FRAMES_DEFAULT;
+        gBench.ms       = malloc((size_t)gBench.frames * sizeof(float));
+        if (!gBench.ms) return false;
+        gBench.scenario = (BenchScenario)s;
+        return true;
+    }
+    return false;
+}
+
+bool BenchModeActive(void)
+{
+    return gBench.scenario != BENCH_NONE;
+}
+
+const char *BenchModeScenarioNames(void)
+{
+    return "hub, proc, captain, inventory";
+}
+
+void BenchScenarioPrepare(GameState *gs)
+{
+    SetRandomSeed(BENCH_RNG_SEED);
+    switch (gBench.scenario) {
+        case BENCH_PROC:
+            gs->currentMapId   = MAP_HARBOR_PROC;
+            gs->currentFloor   = BENCH_PROC_FLOOR;
+            gs->currentMapSeed = BENCH_PROC_SEED;
+            break;
+        case BENCH_CAPTAIN: {
+            gs->currentMapId = MAP_HARBOR_F7;
+            gs->currentFloor = 7;
+            gs->devGodMode   = true;
+            Combatant *jan = &gs->party.members[0];
+            CombatantInit(jan, jan->def->id, BENCH_PARTY_LVL);
+            PartyAddMember(&gs->party, CREATURE_SEAL, BENCH_PARTY_LVL);
+            break;
+        }
+        case BENCH_INVENTORY: {
+            // Fill every slot the bag has, cycling through what exists.
+            Inventory *inv = &gs->party.inventory;
+            for (int id = 0; id < ITEM_COUNT; id++) InventoryAddItem(inv, id, 5);
+            for (int n = 0; n < INVENTORY_MAX_WEAPONS * MOVE_COUNT; n++) {
+                const MoveDef *mv = GetMoveDef(n % MOVE_COUNT);
+                if (!mv->isWeapon) continue;
+                if (!InventoryAddWeaponEx(inv, n % MOVE_COUNT, mv->defaultDurability, 0)) break;
+            }
+            for (int n = 0; n < INVENTORY_MAX_ARMORS; n++) {
+                if (!InventoryAddArmor(inv, n % ARMOR_COUNT)) break;
+            }
+            break;
+        }
+        default:
+            break;   // hub: GameStateInit already starts there
+    }
+}
+
+void BenchScenarioEnter(FieldState *f)
+{
+    if (gBench.scenario == BENCH_CAPTAIN) {
+        for (int i = 0; i < f->enemyCount; i++) {
+            if (f->enemies[i].creatureId != CREATURE_CAPTAIN_BOSS) continue;
+            FieldStartBattle(f, i);
+            break;
+        }
+    } else if (gBench.scenario == BENCH_INVENTORY) {
+        InventoryUIOpen(&f->invUi);
+        f->invUi.tab = INV_TAB_WEAPONS;
+    }
+}
+
+void BenchModeFrameEnd(void)
+{
+    if (!BenchModeActive()) return;
+    double now = GetTime();
+    if (gBench.seen++ >= BENCH_WARMUP_FRAMES && gBench.count < gBench.frames)
+        gBench.ms[gBench.count++] = (float)((now - gBench.last) * 1000.0);
+    gBench.last = now;
+}
+
+bool BenchModeFinished(void)
+{
+    return BenchModeActive() && gBench.count >= gBench.frames;
+}
+
+static int CompareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a, fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+// Nearest-rank percentile over the sorted samples.
+static float Percentile(const float *sorted, int n, double q)
+{
+    int rank = (int)(q * n + 0.999999);
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+void BenchModeReport(void)
+{
+    if (!BenchModeActive() || gBench.count == 0) return;
+    int n = gBench.count;
+    qsort(gBench.ms, (size_t)n, sizeof(float), CompareFloat);
+    double sum = 0.0;
+    for (int i = 0; i < n; i++) sum += gBench.ms[i];
+    double mean = sum / n;
+    printf("bench %s: %d frames (+%d warm-up) mean %.3f ms (%.0f fps) "
+           "p50 %.3f p90 %.3f p99 %.3f max %.3f ms\n",
+           kScenarioNames[gBench.scenario], n, BENCH_WARMUP_FRAMES, mean,
+           mean > 0.0 ? 1000.0 / mean : 0.0,
+           Percentile(gBench.ms, n, 0.50), Percentile(gBench.ms, n, 0.90),
+           Percentile(gBench.ms, n, 0.99), gBench.ms[n - 1]);
+    free(gBench.ms);
+    gBench.ms = NULL;
+}
@@ -0,0 +1,52 @@
+#ifndef BENCH_MODE_H
+#define BENCH_MODE_H
+
+#include <stdbool.h>
+
+// Scripted render benchmarks: `--bench <scenario>` on either entry point
+// skips LOGO/TITLE, builds one canned scene directly (the way the F9 dev warp
+// does, through MapBuild), runs it unpaced — no vsync, no SetTargetFPS — for
+// a fixed number of frames with no input, then prints frame-time
+// percentiles. Scenes are seeded, so runs compare across builds.
+//
+//   hub        village hub at its default spawn
+//   proc       procedural harbor floor 3, fixed seed
+//   captain    F7 captain arena with the boss battle under way (god mode
+//              on, so the scene can't end mid-run)
+//   inventory  hub with the inventory open over a full bag
+
+struct GameState;
+struct FieldState;
+
+typedef enum BenchScenario {
+    BENCH_NONE = 0,
+    BENCH_HUB,
+    BENCH_PROC,
+    BENCH_CAPTAIN,
+    BENCH_INVENTORY,
+    BENCH_SCENARIO_COUNT,
+} BenchScenario;
+
+#define BENCH_FRAMES_DEFAULT 600
+#define BENCH_WARMUP_FRAMES  30     // run before measuring; caches fill here
+
+// Selects a scenario by name and the number of measured frames (<= 0 for
+// the default). Returns false for an unknown name.
+bool BenchModeStart(const char *scenario, int frames);
+bool BenchModeActive(void);
+const char *BenchModeScenarioNames(void);   // for usage messages
+
+// Called by InitGameplayScreen: Prepare fills a fresh GameState before
+// FieldInit (map, party, bag); Enter sets up the built field (battle,
+// overlays).
+void BenchScenarioPrepare(struct GameState *gs);
+void BenchScenarioEnter(struct FieldState *f);
+
+// Records the frame just presented. Call once per frame, after EndDrawing.
+void BenchModeFrameEnd(void);
+bool BenchModeFinished(void);
+
+// Prints the percentiles to stdout. Call once at exit.
+void BenchModeReport(void);
+
+#endif // BENCH_MODE_H
@@ -0,0 +1,192 @@
+#include "profiler.h"
+#include "trace.h"
+#include "raylib.h"
+#include "../screen_layout.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Stats are re-reduced every few frames rather than every frame: sorting the
+// whole history per scope is cheap but pointless at 60 Hz, and a table that
+// updates four times a second is easier to read anyway.
+#define PROF_REFRESH_FRAMES 15
+#define PROF_FONT           12
+#define PROF_ROW_H          15
+
+static const char *kScopeNames[PROF_SCOPE_COUNT] = {
+    "Frame",
+    "FieldUpdate",
+    "EnemyUpdate",
+    "BattleUpdate",
+    "Tiles: bake",
+    "Tiles: prefetch",
+    "Tiles: blit",
+    "Entities",
+    "Modal UI",
+    "Text",
+    "Present",
+};
+
+typedef struct ProfFrame {
+    float          ms[PROF_SCOPE_COUNT];
+    unsigned short calls[PROF_SCOPE_COUNT];
+} ProfFrame;
+
+typedef struct ProfStats {
+    float minMs, avgMs, p99Ms;
+    float avgCalls;
+} ProfStats;
+
+static struct {
+    double    start[PROF_SCOPE_COUNT];   // GetTime at ProfBegin, 0 when idle
+    ProfFrame cur;
+    ProfFrame ring[PROF_HISTORY];
+    int       head;                      // next ring slot to write
+    int       filled;
+    double    lastFrameEnd;
+    bool      visible;
+    bool      drawing;                   // overlay's own text isn't profiled
+    int       sinceRefresh;
+    ProfStats stats[PROF_SCOPE_COUNT];
+} gProf;
+
+// Every scope but TEXT doubles as a trace zone; per-call text zones would
+// push everything else out of the trace ring within a few frames.
+#if PROF_ENABLED
+void ProfBegin(ProfScope s)
+{
+    if (gProf.drawing) return;
+    if (s != PROF_TEXT) TraceBegin(kScopeNames[s]);
+    gProf.start[s] = GetTime();
+}
+
+void ProfEnd(ProfScope s)
+{
+    if (gProf.drawing || gProf.start[s] == 0.0) return;
+    if (s != PROF_TEXT) TraceEnd();
+    gProf.cur.ms[s] += (float)((GetTime() - gProf.start[s]) * 1000.0);
+    if (gProf.cur.calls[s] < 0xFFFF) gProf.cur.calls[s]++;
+    gProf.start[s] = 0.0;
+}
+#else
+void ProfBegin(ProfScope s)
+{
+    if (s != PROF_TEXT && TraceEnabled()) TraceBegin(kScopeNames[s]);
+}
+
+void ProfEnd(ProfScope s)
+{
+    if (s != PROF_TEXT && TraceEnabled()) TraceEnd();
+}
+#endif
+
+void ProfFrameEnd(void)
+{
+    double now = GetTime();
+    if (gProf.lastFrameEnd > 0.0) {
+        gProf.cur.ms[PROF_FRAME]    = (float)((now - gProf.lastFrameEnd) * 1000.0);
+        gProf.cur.calls[PROF_FRAME] = 1;
+    }
+    gProf.lastFrameEnd = now;
+
+    gProf.ring[gProf.head] = gProf.cur;
+    gProf.head = (gProf.head + 1) % PROF_HISTORY;
+    if (gProf.filled < PROF_HISTORY) gProf.filled++;
+    memset(&gProf.cur, 0, sizeof(gProf.cur));
+    gProf.sinceRefresh++;
+}
+
+void ProfToggleOverlay(void)
+{
+    gProf.visible = !gProf.visible;
+    gProf.sinceRefresh = PROF_REFRESH_FRAMES;   // fresh numbers on open
+}
+
+bool ProfOverlayVisible(void) { return gProf.visible; }
+
+static int CompareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a, fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static void ProfReduce(void)
+{
+    static float sorted[PROF_HISTORY];
+    int n = gProf.filled;
+    for (int s = 0; s < PROF_SCOPE_COUNT; s++) {
+        ProfStats *st = &gProf.stats[s];
+        memset(st, 0, sizeof(*st));
+        if (n == 0) continue;
+        double sum = 0.0, calls = 0.0;
+        for (int i = 0; i < n; i++) {
+            sorted[i] = gProf.ring[i].ms[s];
+            sum   += sorted[i];
+            calls += gProf.ring[i].calls[s];
+        }
+        qsort(sorted, (size_t)n, sizeof(float), CompareFloat);
+        int p99 = (n * 99 + 99) / 100 - 1;   // ceil(0.99 n) - 1
+        st->minMs    = sorted[0];
+        st->avgMs    = (float)(sum / n);
+        st->p99Ms    = sorted[p99];
+        st->avgCalls = (float)(calls / n);
+    }
+}
+
+void ProfDrawOverlay(void)
+{
+    if (!gProf.visible) return;
+    if (gProf.sinceRefresh >= PROF_REFRESH_FRAMES) {
+        ProfReduce();
+        gProf.sinceRefresh = 0;
+    }
+
+    gProf.drawing = true;
+    const int colCalls = 112, colMin = 160, colAvg = 208, colP99 = 256;
+    int rows = PROF_SCOPE_COUNT + 2;
+#ifdef RAYLIB_SHIM_H
+    // SDL3 builds with DDKP_RENDER_STATS also show last frame's submissions.
+    RenderStats rs = GetRenderStats();
+    if (rs.enabled) rows++;
+#endif
+    int w = 310, h = PROF_ROW_H * rows + 8;
+    int x = GetScreenWidth() - w - 8, y = 8;
+    DrawRectangle(x, y, w, h, (Color){10, 10, 20, 210});
+    DrawRectangleLines(x, y, w, h, (Color){90, 90, 120, 255});
+
+    char buf[64];
+    int ty = y + 4;
+    Color head = {160, 170, 200, 255};
+    snprintf(buf, sizeof(buf), "ms over %d frames", gProf.filled);
+    DrawText(buf, x + 6, ty, PROF_FONT, head);
+    DrawText("calls", x + colCalls, ty, PROF_FONT, head);
+    DrawText("min",   x + colMin,   ty, PROF_FONT, head);
+    DrawText("avg",   x + colAvg,   ty, PROF_FONT, head);
+    DrawText("p99",   x + colP99,   ty, PROF_FONT, head);
+    ty += PROF_ROW_H + 2;
+
+    for (int s = 0; s < PROF_SCOPE_COUNT; s++) {
+        const ProfStats *st = &gProf.stats[s];
+        // A scope whose p99 eats a third of a 60 Hz frame is worth a look.
+        Color c = st->p99Ms > 5.5f && s != PROF_FRAME ? (Color){255, 150, 90, 255}
+                                                      : (Color){220, 220, 230, 255};
+        DrawText(kScopeNames[s], x + 6, ty, PROF_FONT, c);
+        snprintf(buf, sizeof(buf), "%.1f", st->avgCalls);
+        DrawText(buf, x + colCalls, ty, PROF_FONT, c);
+        snprintf(buf, sizeof(buf), "%.2f", st->minMs);
+        DrawText(buf, x + colMin, ty, PROF_FONT, c);
+        snprintf(buf, sizeof(buf), "%.2f", st->avgMs);
+        DrawText(buf, x + colAvg, ty, PROF_FONT, c);
+        snprintf(buf, sizeof(buf), "%.2f", st->p99Ms);
+        DrawText(buf, x + colP99, ty, PROF_FONT, c);
+        ty += PROF_ROW_H;
+    }
+#ifdef RAYLIB_SHIM_H
+    if (rs.enabled) {
+        snprintf(buf, sizeof(buf), "SDL: %d geom  %d verts  %d binds  %d blits",
+                 rs.geometryCalls, rs.vertices, rs.textureBinds, rs.textureBlits);
+        DrawText(buf, x + 6, ty + 2, PROF_FONT, head);
+    }
+#endif
+    gProf.drawing = false;
+}
@@ -0,0 +1,57 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+
+// Scoped frame timers with an on-screen overlay, for answering "which
+// subsystem spiked on that floor?" on devices where a native profiler isn't
+// an option. Each scope accumulates wall time (and a call count) for the
+// current frame; ProfFrameEnd commits the frame into a ring of the last
+// PROF_HISTORY frames, which the overlay reduces to min / avg / p99.
+//
+// Scopes are inclusive: FIELD_UPDATE contains BATTLE_UPDATE and every
+// ENEMY_UPDATE, the draw scopes contain their TEXT. A scope must not be
+// re-entered before it ends (the timers don't stack).
+
+#define PROF_HISTORY 300   // ~5 s at 60 fps
+
+typedef enum ProfScope {
+    PROF_FRAME = 0,        // ProfFrameEnd to ProfFrameEnd, vsync wait included
+    PROF_FIELD_UPDATE,
+    PROF_ENEMY_UPDATE,     // one call per awake enemy
+    PROF_BATTLE_UPDATE,
+    PROF_TILE_BAKE,        // TileMapDraw: visible chunks re-baked / acquired
+    PROF_TILE_PREFETCH,    // TileMapDraw: off-screen chunk prefetch
+    PROF_TILE_BLIT,        // TileMapDraw: chunk quads
+    PROF_ENTITY_DRAW,      // huts, enemies, NPCs, objects, Jan, followers
+    PROF_MODAL_DRAW,       // battle UI, dialogue, every field modal
+    PROF_TEXT,             // DrawText / MeasureText shims
+    PROF_PRESENT,          // EndDrawing: batch flush, swap, frame pacing
+    PROF_SCOPE_COUNT
+} ProfScope;
+
+// The overlay is a DEV_BUILD tool (F11), so release builds compile out the
+// GetTime accumulation: no timer pair around every text draw. The scopes
+// still open trace zones there, behind TraceEnabled(), so DDKP_TRACE works
+// on a shipped build.
+#ifdef DEV_BUILD
+#define PROF_ENABLED 1
+#else
+#define PROF_ENABLED 0
+#endif
+
+void ProfBegin(ProfScope s);
+void ProfEnd(ProfScope s);
+
+// Commits the frame's scope totals to the history ring. Call once per frame,
+// after EndDrawing.
+void ProfFrameEnd(void);
+
+void ProfToggleOverlay(void);
+bool ProfOverlayVisible(void);
+
+// Draws the stats table in screen space. No-op while hidden; call last,
+// after the screen and transition draws, so it sits on top.
+void ProfDrawOverlay(void);
+
+#endif // PROFILER_H
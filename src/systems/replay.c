@@ -0,0 +1,479 @@
+#define REPLAY_NO_REDIRECT
+#include "replay.h"
+#include "../state/game_state.h"
+#include "../state/save.h"
+#include "../screen_layout.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// File layout: a fixed header, then a stream of tagged records.
+//   'F' frame  u8 flags, f32 dt, [f32 x, f32 y if pointer down],
+//              u8 held-key count, u16 key codes
+//   'S' state  u32 size, SaveGameSnapshot bytes
+// A frame is ~7 bytes with nothing held, so an hour is a few MB.
+#define REPLAY_MAGIC     0x524B4444u   // 'D','D','K','R' little-endian
+#define REPLAY_VERSION   2u
+#define REPLAY_MAX_HELD  16
+#define REPLAY_FLAG_PTR  0x01
+// Key codes sampled while recording: raylib's printable block (KEY_SPACE ..
+// KEY_GRAVE) and its function/navigation block (KEY_ESCAPE .. KEY_KB_MENU).
+// Spelled as numbers because the SDL3 shim only defines the keys we use.
+#define REPLAY_KEYS_A_LAST 96
+#define REPLAY_KEYS_B_LAST 348
+
+typedef struct ReplayHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t rngSeed;
+    uint32_t frames;
+    uint32_t saveExisted;   // savegame.dat was present at the first frame
+} ReplayHeader;
+
+typedef enum { REPLAY_OFF = 0, REPLAY_RECORD, REPLAY_PLAY, REPLAY_BOT } ReplayMode;
+
+typedef struct ReplayInput {
+    int     held[REPLAY_MAX_HELD];
+    int     heldCount;
+    bool    pointerDown;
+    Vector2 pointer;
+    float   dt;
+} ReplayInput;
+
+static struct {
+    ReplayMode     mode;
+    char           path[256];
+    uint32_t       rngSeed;
+    bool           seeded;
+    bool           realtime;
+    bool           saveExisted;        // header flag, see ReplaySaveExists
+    bool           savedSince;
+    bool           finished;
+
+    ReplayInput    cur, prev;
+    double         clock;              // sum of frame times
+
+    FILE          *out;                // recording target, opened up front
+    unsigned char *buf;                // recording being built / file loaded
+    size_t         len, cap, pos;
+    bool           outOfMemory;        // recording lost bytes; don't write it
+    uint32_t       frames;
+    const unsigned char *pendingState; // playback: 'S' record for this frame
+    uint32_t       pendingStateSize;
+
+    // Live state for the final hash, set by ReplayNoteGameState.
+    const GameState *gs;
+    const int     *playerX, *playerY, *playerDir;
+
+    // Bot: LCG state, and the arrow held until botDirFrames runs out.
+    uint32_t       botRng;
+    int            botDir, botDirFrames;
+
+    // Wall time per frame, for the playback report.
+    float         *frameMs;
+    size_t         frameMsCount, frameMsCap;
+    double         lastBegin, firstBegin;
+} gReplay;
+
+static void Put(const void *p, size_t n)
+{
+    if (gReplay.len + n > gReplay.cap) {
+        size_t cap = gReplay.cap ? gReplay.cap * 2 : (1 << 16);
+        while (cap < gReplay.len + n) cap *= 2;
+        unsigned char *nb = realloc(gReplay.buf, cap);
+        if (!nb) { gReplay.outOfMemory = true; return; }
+        gReplay.buf = nb;
+        gReplay.cap = cap;
+    }
+    memcpy(gReplay.buf + gReplay.len, p, n);
+    gReplay.len += n;
+}
+
+static bool Get(void *p, size_t n)
+{
+    if (gReplay.pos + n > gReplay.len) return false;
+    memcpy(p, gReplay.buf + gReplay.pos, n);
+    gReplay.pos += n;
+    return true;
+}
+
+void ReplayInit(void)
+{
+    const char *rec  = getenv("DDKP_RECORD");
+    const char *play = getenv("DDKP_REPLAY");
+    if (play && play[0] != '\0') {
+        const char *rt = getenv("DDKP_REPLAY_REALTIME");
+        ReplayStartPlayback(play, rt && strcmp(rt, "1") == 0);
+    } else if (rec && rec[0] != '\0') {
+        ReplayStartRecording(rec);
+    }
+}
+
+bool ReplayStartRecording(const char *path)
+{
+    if (gReplay.mode != REPLAY_OFF) return false;
+    // Opened now: main changes into the binary's directory before the first
+    // frame, and a relative path should mean the caller's directory.
+    gReplay.out = fopen(path, "wb");
+    if (!gReplay.out) return false;
+    snprintf(gReplay.path, sizeof(gReplay.path), "%s", path);
+    gReplay.rngSeed = (uint32_t)time(NULL);
+    ReplayHeader h = { REPLAY_MAGIC, REPLAY_VERSION, gReplay.rngSeed, 0, 0 };
+    Put(&h, sizeof(h));
+    gReplay.mode = REPLAY_RECORD;
+    return true;
+}
+
+bool ReplayStartPlayback(const char *path, bool realtime)
+{
+    if (gReplay.mode != REPLAY_OFF) return false;
+    int size = 0;
+    unsigned char *raw = LoadFileData(path, &size);
+    if (!raw) return false;
+
+    ReplayHeader h;
+    if (size < (int)sizeof(h)) { UnloadFileData(raw); return false; }
+    memcpy(&h, raw, sizeof(h));
+    if (h.magic != REPLAY_MAGIC || h.version != REPLAY_VERSION) {
+        fprintf(stderr, "replay: %s is not a version %u recording\n", path, REPLAY_VERSION);
+        UnloadFileData(raw);
+        return false;
+    }
+    // Own copy, so shutdown frees one way for both modes.
+    gReplay.buf = malloc((size_t)size);
+    if (!gReplay.buf) { UnloadFileData(raw); return false; }
+    memcpy(gReplay.buf, raw, (size_t)size);
+    UnloadFileData(raw);
+
+    snprintf(gReplay.path, sizeof(gReplay.path), "%s", path);
+    gReplay.len      = (size_t)size;
+    gReplay.pos      = sizeof(h);
+    gReplay.rngSeed  = h.rngSeed;
+    gReplay.saveExisted = h.saveExisted != 0;
+    gReplay.realtime = realtime;
+    gReplay.mode     = REPLAY_PLAY;
+    return true;
+}
+
+bool ReplayStartBot(unsigned seed)
+{
+    if (gReplay.mode != REPLAY_OFF) return false;
+    snprintf(gReplay.path, sizeof(gReplay.path), "bot seed %u", seed);
+    gReplay.rngSeed = seed;
+    gReplay.botRng  = seed ? seed : 1u;
+    gReplay.mode    = REPLAY_BOT;
+    return true;
+}
+
+bool ReplayRecording(void) { return gReplay.mode == REPLAY_RECORD; }
+bool ReplayPlaying(void)   { return gReplay.mode == REPLAY_PLAY || gReplay.mode == REPLAY_BOT; }
+bool ReplayFinished(void)  { return gReplay.finished; }
+bool ReplayUnpaced(void)   { return ReplayPlaying() && !gReplay.realtime; }
+
+static bool LivePointer(Vector2 *out)
+{
+    if (GetTouchPointCount() > 0) { *out = GetTouchPosition(0); return true; }
+    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) { *out = GetMousePosition(); return true; }
+    return false;
+}
+
+static void SampleLive(ReplayInput *in)
+{
+    memset(in, 0, sizeof(*in));
+    for (int k = KEY_SPACE; k <= REPLAY_KEYS_A_LAST && in->heldCount < REPLAY_MAX_HELD; k++)
+        if (IsKeyDown(k)) in->held[in->heldCount++] = k;
+    for (int k = KEY_ESCAPE; k <= REPLAY_KEYS_B_LAST && in->heldCount < REPLAY_MAX_HELD; k++)
+        if (IsKeyDown(k)) in->held[in->heldCount++] = k;
+    in->pointerDown = LivePointer(&in->pointer);
+    in->dt = GetFrameTime();
+}
+
+static bool Held(const ReplayInput *in, int key)
+{
+    for (int i = 0; i < in->heldCount; i++)
+        if (in->held[i] == key) return true;
+    return false;
+}
+
+static int BotRand(int n)
+{
+    gReplay.botRng = gReplay.botRng * 1664525u + 1013904223u;
+    return (int)((gReplay.botRng >> 8) % (uint32_t)n);
+}
+
+// Walks in runs, taps confirm often enough to get through dialogue and
+// menus, and now and then cancels, opens a menu or taps the screen.
+static void SampleBot(ReplayInput *in)
+{
+    static const int kArrows[4] = { KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT };
+    static const int kTaps[] = { KEY_Z, KEY_Z, KEY_Z, KEY_ENTER, KEY_X, KEY_ESCAPE,
+                                 KEY_I, KEY_C, KEY_TAB };
+    memset(in, 0, sizeof(*in));
+    in->dt = 1.0f / 60.0f;
+    if (--gReplay.botDirFrames <= 0) {
+        gReplay.botDir       = BotRand(5) - 1;     // -1 = stand still
+        gReplay.botDirFrames = 6 + BotRand(40);
+    }
+    if (gReplay.botDir >= 0) in->held[in->heldCount++] = kArrows[gReplay.botDir];
+    // A key is "pressed" on its first held frame; skip frames that would
+    // merge with the previous tap of the same key.
+    if (BotRand(12) == 0) {
+        int key = kTaps[BotRand((int)(sizeof(kTaps) / sizeof(kTaps[0])))];
+        if (!Held(&gReplay.prev, key)) in->held[in->heldCount++] = key;
+    }
+    if (BotRand(240) == 0 || (gReplay.prev.pointerDown && BotRand(3) != 0)) {
+        in->pointerDown = true;
+        in->pointer = gReplay.prev.pointerDown
+                    ? gReplay.prev.pointer
+                    : (Vector2){ (float)BotRand(SCREEN_W), (float)BotRand(SCREEN_H) };
+    }
+}
+
+static void WriteFrame(const ReplayInput *in)
+{
+    unsigned char tag = 'F', flags = in->pointerDown ? REPLAY_FLAG_PTR : 0;
+    unsigned char n = (unsigned char)in->heldCount;
+    Put(&tag, 1);
+    Put(&flags, 1);
+    Put(&in->dt, sizeof(float));
+    if (in->pointerDown) {
+        Put(&in->pointer.x, sizeof(float));
+        Put(&in->pointer.y, sizeof(float));
+    }
+    Put(&n, 1);
+    for (int i = 0; i < in->heldCount; i++) {
+        uint16_t k = (uint16_t)in->held[i];
+        Put(&k, sizeof(k));
+    }
+}
+
+static bool ReadFrame(ReplayInput *in)
+{
+    unsigned char tag = 0, flags = 0, n = 0;
+    memset(in, 0, sizeof(*in));
+    if (!Get(&tag, 1) || tag != 'F' || !Get(&flags, 1) || !Get(&in->dt, sizeof(float)))
+        return false;
+    if (flags & REPLAY_FLAG_PTR) {
+        in->pointerDown = true;
+        if (!Get(&in->pointer.x, sizeof(float)) || !Get(&in->pointer.y, sizeof(float)))
+            return false;
+    }
+    if (!Get(&n, 1) || n > REPLAY_MAX_HELD) return false;
+    for (int i = 0; i < n; i++) {
+        uint16_t k;
+        if (!Get(&k, sizeof(k))) return false;
+        in->held[i] = k;
+    }
+    in->heldCount = n;
+
+    // A state record belongs to the frame it follows.
+    gReplay.pendingState = NULL;
+    if (gReplay.pos < gReplay.len && gReplay.buf[gReplay.pos] == 'S') {
+        uint32_t size;
+        gReplay.pos++;
+        if (!Get(&size, sizeof(size)) || gReplay.pos + size > gReplay.len) return false;
+        gReplay.pendingState     = gReplay.buf + gReplay.pos;
+        gReplay.pendingStateSize = size;
+        gReplay.pos += size;
+    }
+    return true;
+}
+
+static void NoteFrameWallTime(void)
+{
+    double now = GetTime();
+    if (gReplay.frames > 1) {
+        if (gReplay.frameMsCount == gReplay.frameMsCap) {
+            size_t cap = gReplay.frameMsCap ? gReplay.frameMsCap * 2 : 4096;
+            float *nb = realloc(gReplay.frameMs, cap * sizeof(float));
+            if (!nb) return;
+            gReplay.frameMs    = nb;
+            gReplay.frameMsCap = cap;
+        }
+        gReplay.frameMs[gReplay.frameMsCount++] = (float)((now - gReplay.lastBegin) * 1000.0);
+    } else {
+        gReplay.firstBegin = now;
+    }
+    gReplay.lastBegin = now;
+}
+
+void ReplayFrameBegin(void)
+{
+    if (gReplay.mode == REPLAY_OFF || gReplay.finished) return;
+    // Seeded here rather than at start: InitWindow reseeds raylib's RNG.
+    // The save check waits too: main has only now moved into the binary's
+    // directory, where the relative save path resolves.
+    if (!gReplay.seeded) {
+        SetRandomSeed(gReplay.rngSeed);
+        if (gReplay.mode == REPLAY_RECORD) gReplay.saveExisted = SaveGameExists();
+        gReplay.seeded = true;
+    }
+
+    gReplay.prev = gReplay.cur;
+    if (gReplay.mode == REPLAY_RECORD) {
+        SampleLive(&gReplay.cur);
+        WriteFrame(&gReplay.cur);
+    } else if (gReplay.mode == REPLAY_BOT) {
+        SampleBot(&gReplay.cur);
+    } else if (!ReadFrame(&gReplay.cur)) {
+        // Out of frames: release everything and let the loop wind down.
+        memset(&gReplay.cur, 0, sizeof(gReplay.cur));
+        gReplay.finished = true;
+        return;
+    }
+    gReplay.frames++;
+    gReplay.clock += gReplay.cur.dt;
+    if (ReplayPlaying()) NoteFrameWallTime();
+}
+
+// Recording reads its own samples back too, so a session behaves the same
+// while being recorded as when it is replayed.
+bool ReplayKeyPressed(int key)
+{
+    if (gReplay.mode == REPLAY_OFF) return IsKeyPressed(key);
+    return Held(&gReplay.cur, key) && !Held(&gReplay.prev, key);
+}
+
+bool ReplayKeyDown(int key)
+{
+    if (gReplay.mode == REPLAY_OFF) return IsKeyDown(key);
+    return Held(&gReplay.cur, key);
+}
+
+bool ReplayPointer(Vector2 *out)
+{
+    if (gReplay.mode == REPLAY_OFF) return LivePointer(out);
+    if (gReplay.cur.pointerDown) *out = gReplay.cur.pointer;
+    return gReplay.cur.pointerDown;
+}
+
+float ReplayFrameTime(void)
+{
+    return gReplay.mode == REPLAY_OFF ? GetFrameTime() : gReplay.cur.dt;
+}
+
+double ReplayTime(void)
+{
+    return gReplay.mode == REPLAY_OFF ? GetTime() : gReplay.clock;
+}
+
+bool ReplaySaveExists(bool *exists)
+{
+    if (gReplay.mode != REPLAY_PLAY) return false;
+    *exists = gReplay.saveExisted || gReplay.savedSince;
+    return true;
+}
+
+void ReplayNoteSave(void)
+{
+    gReplay.savedSince = true;
+}
+
+bool ReplayTakeGameState(GameState *gs, int *playerX, int *playerY, int *playerDir)
+{
+    if (gReplay.mode != REPLAY_PLAY || !gReplay.pendingState) return false;
+    bool ok = LoadGameSnapshot(gs, gReplay.pendingState, (int)gReplay.pendingStateSize,
+                               playerX, playerY, playerDir);
+    if (!ok) fprintf(stderr, "replay: starting state is from another save version\n");
+    gReplay.pendingState = NULL;
+    return ok;
+}
+
+void ReplayNoteGameState(const GameState *gs, const int *playerX, const int *playerY,
+                         const int *playerDir)
+{
+    gReplay.gs        = gs;
+    gReplay.playerX   = playerX;
+    gReplay.playerY   = playerY;
+    gReplay.playerDir = playerDir;
+    if (gReplay.mode != REPLAY_RECORD) return;
+
+    uint32_t size = (uint32_t)SaveSnapshotSize();
+    unsigned char *snap = malloc(size);
+    if (!snap) return;
+    SaveGameSnapshot(gs, *playerX, *playerY, *playerDir, snap);
+    unsigned char tag = 'S';
+    Put(&tag, 1);
+    Put(&size, sizeof(size));
+    Put(snap, size);
+    free(snap);
+}
+
+// FNV-1a over the save-format snapshot: everything durable about the run,
+// and stable across builds that share a SAVE_VERSION.
+static uint32_t FinalStateHash(void)
+{
+    if (!gReplay.gs) return 0;
+    int size = SaveSnapshotSize();
+    unsigned char *snap = malloc((size_t)size);
+    if (!snap) return 0;
+    SaveGameSnapshot(gReplay.gs, *gReplay.playerX, *gReplay.playerY, *gReplay.playerDir, snap);
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < size; i++) {
+        h ^= snap[i];
+        h *= 16777619u;
+    }
+    free(snap);
+    return h;
+}
+
+static int CompareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a, fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static void PrintReport(void)
+{
+    size_t n = gReplay.frameMsCount;
+    float mean = 0.0f, p50 = 0.0f, p90 = 0.0f, p99 = 0.0f, max = 0.0f;
+    if (n > 0) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; i++) sum += gReplay.frameMs[i];
+        qsort(gReplay.frameMs, n, sizeof(float), CompareFloat);
+        mean = (float)(sum / (double)n);
+        p50  = gReplay.frameMs[(n * 50 + 99) / 100 - 1];
+        p90  = gReplay.frameMs[(n * 90 + 99) / 100 - 1];
+        p99  = gReplay.frameMs[(n * 99 + 99) / 100 - 1];
+        max  = gReplay.frameMs[n - 1];
+    }
+    double wall = gReplay.lastBegin - gReplay.firstBegin;
+    printf("replay: %s: %u frames (%.1f s simulated) in %.2f s wall\n",
+           gReplay.path, gReplay.frames, gReplay.clock, wall);
+    printf("replay: frame ms mean %.3f  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n",
+           mean, p50, p90, p99, max);
+    printf("replay: final state %08x%s\n", FinalStateHash(),
+           (gReplay.finished || gReplay.mode == REPLAY_BOT) ? "" : " (stopped before the end)");
+}
+
+void ReplayShutdown(void)
+{
+    if (gReplay.mode == REPLAY_RECORD) {
+        // Frame count and save presence go into the header now that they
+        // are known.
+        bool ok = gReplay.buf != NULL && !gReplay.outOfMemory;
+        if (ok) {
+            uint32_t saveExisted = gReplay.saveExisted;
+            memcpy(gReplay.buf + offsetof(ReplayHeader, frames), &gReplay.frames,
+                   sizeof(gReplay.frames));
+            memcpy(gReplay.buf + offsetof(ReplayHeader, saveExisted), &saveExisted,
+                   sizeof(saveExisted));
+            ok = fwrite(gReplay.buf, 1, gReplay.len, gReplay.out) == gReplay.len;
+        }
+        ok = (fclose(gReplay.out) == 0) && ok;
+        if (ok) {
+            printf("replay: recorded %u frames to %s, final state %08x\n",
+                   gReplay.frames, gReplay.path, FinalStateHash());
+        } else {
+            fprintf(stderr, "replay: writing %s failed\n", gReplay.path);
+        }
+    } else if (ReplayPlaying()) {
+        PrintReport();
+    }
+    free(gReplay.buf);
+    free(gReplay.frameMs);
+    memset(&gReplay, 0, sizeof(gReplay));
+}
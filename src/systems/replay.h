@@ -0,0 +1,82 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+// Input recording and deterministic replay. A recording is everything the
+// simulation reads from outside itself:
+//   * per frame: the held-key set, the primary pointer (touch or left
+//     mouse) and the frame time;
+//   * the RNG seed, applied on the first frame;
+//   * whether savegame.dat existed at the first frame (the title screen's
+//     default button, and so what the first Enter does, depends on it);
+//   * the GameState (save-format snapshot, which carries currentMapSeed and
+//     the player's tile) at the moment gameplay starts.
+// Replaying it reruns the session frame-for-frame, paced at 60 Hz or as
+// fast as the machine goes, and prints frame-time stats plus a hash of the
+// final state so two builds can be checked to have played the same game.
+//
+// Recordings are native-endian and tied to one backend (raylib and the SDL3
+// shim draw different random numbers from the same seed) and to one
+// SAVE_VERSION.
+//
+// Off by default. ReplayInit starts one from DDKP_RECORD=<path> or
+// DDKP_REPLAY=<path> (DDKP_REPLAY_REALTIME=1 paces it).
+
+void ReplayInit(void);
+bool ReplayStartRecording(const char *path);
+bool ReplayStartPlayback(const char *path, bool realtime);
+// Random-input bot for soak runs: frames are made up from `seed` (held
+// arrows, confirm / cancel / menu taps, the odd pointer tap) at a fixed
+// 60 Hz step, unpaced, and never run out. Counts as playback, so the save
+// file is left alone.
+bool ReplayStartBot(unsigned seed);
+
+bool ReplayRecording(void);
+bool ReplayPlaying(void);       // recorded or bot input drives the game
+bool ReplayFinished(void);      // playback has run out of frames
+bool ReplayUnpaced(void);       // fast playback: skip vsync and SetTargetFPS
+
+// Samples (recording) or loads (playback) this frame's input. Call once per
+// frame before anything reads input, TouchInputUpdate included.
+void ReplayFrameBegin(void);
+
+// Input and clock as the simulation should see them: live when off, the
+// frame's record otherwise. ReplayTime is the sum of frame times, so timed
+// gestures replay identically however fast playback runs.
+bool   ReplayKeyPressed(int key);
+bool   ReplayKeyDown(int key);
+bool   ReplayPointer(Vector2 *out);
+float  ReplayFrameTime(void);
+double ReplayTime(void);
+
+// Save-file presence as the recorded session saw it. During playback this
+// returns true and sets *exists: present at the recording's first frame, or
+// saved since (playback skips the real write, so the disk can't say).
+// Otherwise it returns false and the caller checks the disk. SaveGame calls
+// ReplayNoteSave for every save.
+bool ReplaySaveExists(bool *exists);
+void ReplayNoteSave(void);
+
+// Gameplay start. Take returns the recorded starting state during playback
+// (false otherwise); Note records it, and remembers where the live state is
+// for the final hash. Player tile/dir ride along with the GameState.
+struct GameState;
+bool ReplayTakeGameState(struct GameState *gs, int *playerX, int *playerY, int *playerDir);
+void ReplayNoteGameState(const struct GameState *gs, const int *playerX, const int *playerY,
+                         const int *playerDir);
+
+// Writes the recording, or prints the playback report. Call once at exit.
+void ReplayShutdown(void);
+
+// Game code reads keys and frame time through the replay layer. Name-only
+// macros, like DrawText in screen_layout.h, so the call sites stay plain
+// raylib.
+#ifndef REPLAY_NO_REDIRECT
+#define IsKeyPressed ReplayKeyPressed
+#define IsKeyDown    ReplayKeyDown
+#define GetFrameTime ReplayFrameTime
+#endif
+
+#endif // REPLAY_H
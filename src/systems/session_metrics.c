@@ -0,0 +1,287 @@
+#include "session_metrics.h"
+#include "raylib.h"
+#include "../screens.h"
+#include "../field/map_source.h"
+#include "../battle/battle.h"
+#include "../state/save.h"
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Log-linear buckets over microseconds, HdrHistogram style: values under
+// 32 us get a bucket each; above that every power of two is split into 16
+// equal sub-buckets, so a bucket is never wider than 1/16 of its value.
+#define METRICS_SUB_BITS  4
+#define METRICS_SUB       (1 << METRICS_SUB_BITS)
+#define METRICS_LINEAR    (2 * METRICS_SUB)          // exact buckets 0..31 us
+#define METRICS_TOP_BIT   24                         // 2^24 us ~ 16.8 s, larger values clamp
+#define METRICS_BUCKETS   (METRICS_LINEAR + (METRICS_TOP_BIT - METRICS_SUB_BITS - 1) * METRICS_SUB)
+#define METRICS_SCREENS   6                          // LOGO .. ENDING
+#define METRICS_MAPS      32                         // distinct (map, floor) seen
+#define METRICS_HITCHES   1024
+#define METRICS_FLUSH_S   60.0                       // periodic rewrite of the JSON
+
+typedef struct FrameHist {
+    uint32_t count[METRICS_BUCKETS];
+    uint64_t frames;
+    double   sumMs;
+    float    maxMs;
+} FrameHist;
+
+typedef struct MapHist {
+    int       mapId, floor;
+    FrameHist h;
+} MapHist;
+
+typedef struct Hitch {
+    float t;            // seconds since the first frame
+    float ms;
+    int   screen, mapId, floor, battleState;
+} Hitch;
+
+static struct {
+    FrameHist screens[METRICS_SCREENS];
+    MapHist   maps[METRICS_MAPS];
+    int       mapCount;
+    Hitch     hitches[METRICS_HITCHES];
+    int       hitchCount;
+    int       hitchesDropped;
+    float     hitchMs;
+    int       mapId, floor, battleState;
+    double    firstFrame, lastFrame;
+    double    lastWrite;
+    bool      focused;
+    bool      started;
+} gMetrics = { .hitchMs = METRICS_HITCH_MS_DEFAULT, .mapId = -1, .floor = -1,
+               .battleState = -1 };
+
+static const char *kScreenNames[METRICS_SCREENS] = {
+    "LOGO", "TITLE", "OPTIONS", "GAMEPLAY", "BATTLE", "ENDING",
+};
+
+static const char *kMapNames[MAP_COUNT] = {
+    "OVERWORLD_HUB", "HARBOR_F1", "HARBOR_PROC", "HARBOR_F6", "HARBOR_F7",
+};
+
+static const char *kBattleStateNames[] = {
+    "PREEMPTIVE_NARRATION", "TURN_START", "MOVE_PHASE", "ENEMY_MOVING",
+    "ACTION_MENU", "MOVE_SELECT", "ITEM_SELECT", "TARGET_SELECT", "EXECUTE",
+    "ANIM", "NARRATION", "ROUND_END", "VICTORY", "DEFEAT", "FLEE",
+};
+_Static_assert(sizeof(kBattleStateNames) / sizeof(kBattleStateNames[0]) == BS_FLEE + 1,
+               "kBattleStateNames out of step with BattleState");
+
+static int BucketOf(uint32_t us)
+{
+    if (us < METRICS_LINEAR) return (int)us;
+    int top = 31;
+    while (!(us >> top)) top--;
+    if (top >= METRICS_TOP_BIT) return METRICS_BUCKETS - 1;   // last real bucket
+    int sub = (int)(us >> (top - METRICS_SUB_BITS)) & (METRICS_SUB - 1);
+    return METRICS_LINEAR + (top - METRICS_SUB_BITS - 1) * METRICS_SUB + sub;
+}
+
+// Lowest value in bucket b, and its width, in microseconds.
+static double BucketLow(int b, double *width)
+{
+    if (b < METRICS_LINEAR) { *width = 1.0; return (double)b; }
+    int top = (b - METRICS_LINEAR) / METRICS_SUB + METRICS_SUB_BITS + 1;
+    int sub = (b - METRICS_LINEAR) % METRICS_SUB;
+    *width = (double)(1u << (top - METRICS_SUB_BITS));
+    return (double)((uint32_t)(METRICS_SUB + sub) << (top - METRICS_SUB_BITS));
+}
+
+static void HistAdd(FrameHist *h, float ms)
+{
+    double us = (double)ms * 1000.0;
+    h->count[BucketOf(us > 4.0e9 ? 0xFFFFFFFFu : (uint32_t)us)]++;
+    h->frames++;
+    h->sumMs += ms;
+    if (ms > h->maxMs) h->maxMs = ms;
+}
+
+// Value at quantile q, reported as its bucket's midpoint (capped at the
+// recorded max so a lone long frame doesn't read longer than it was).
+static float HistQuantile(const FrameHist *h, double q)
+{
+    if (h->frames == 0) return 0.0f;
+    uint64_t want = (uint64_t)(q * (double)h->frames + 0.999999);
+    if (want < 1) want = 1;
+    uint64_t seen = 0;
+    for (int b = 0; b < METRICS_BUCKETS; b++) {
+        seen += h->count[b];
+        if (seen >= want) {
+            double width, low = BucketLow(b, &width);
+            float ms = (float)((low + width * 0.5) / 1000.0);
+            return ms < h->maxMs ? ms : h->maxMs;
+        }
+    }
+    return h->maxMs;
+}
+
+static FrameHist *MapHistFor(int mapId, int floor)
+{
+    for (int i = 0; i < gMetrics.mapCount; i++) {
+        if (gMetrics.maps[i].mapId == mapId && gMetrics.maps[i].floor == floor)
+            return &gMetrics.maps[i].h;
+    }
+    if (gMetrics.mapCount >= METRICS_MAPS) return NULL;
+    MapHist *m = &gMetrics.maps[gMetrics.mapCount++];
+    m->mapId = mapId;
+    m->floor = floor;
+    return &m->h;
+}
+
+void MetricsSetField(int mapId, int floor, int battleState)
+{
+    gMetrics.mapId       = mapId;
+    gMetrics.floor       = floor;
+    gMetrics.battleState = battleState;
+}
+
+void MetricsSetHitchThreshold(float ms)
+{
+    gMetrics.hitchMs = ms;
+}
+
+void MetricsFrameEnd(int screen)
+{
+    double now = GetTime();
+    if (!gMetrics.started) {
+        const char *env = getenv("DDKP_HITCH_MS");
+        if (env && atof(env) > 0.0) gMetrics.hitchMs = (float)atof(env);
+        gMetrics.firstFrame = gMetrics.lastFrame = gMetrics.lastWrite = now;
+        gMetrics.focused = true;
+        gMetrics.started = true;
+        return;
+    }
+    float ms = (float)((now - gMetrics.lastFrame) * 1000.0);
+    gMetrics.lastFrame = now;
+    if (screen < 0 || screen >= METRICS_SCREENS) return;
+
+    HistAdd(&gMetrics.screens[screen], ms);
+    // Map context only means something while the field is on screen.
+    bool inField = (screen == GAMEPLAY && gMetrics.mapId >= 0);
+    if (inField) {
+        FrameHist *mh = MapHistFor(gMetrics.mapId, gMetrics.floor);
+        if (mh) HistAdd(mh, ms);
+    }
+
+    if (ms > gMetrics.hitchMs) {
+        if (gMetrics.hitchCount < METRICS_HITCHES) {
+            gMetrics.hitches[gMetrics.hitchCount++] = (Hitch){
+                .t           = (float)(now - gMetrics.firstFrame),
+                .ms          = ms,
+                .screen      = screen,
+                .mapId       = inField ? gMetrics.mapId : -1,
+                .floor       = inField ? gMetrics.floor : -1,
+                .battleState = inField ? gMetrics.battleState : -1,
+            };
+        } else {
+            gMetrics.hitchesDropped++;
+        }
+    }
+
+    // Phones kill a backgrounded app without ever reaching main's shutdown
+    // path, and the web build never exits, so the file is also rewritten
+    // when the window loses focus (backgrounding, tab hidden) and once a
+    // minute as a backstop. Never on a map transition: that frame is the
+    // hitch we are trying to measure.
+    bool focused = IsWindowFocused();
+    bool lostFocus = gMetrics.focused && !focused;
+    gMetrics.focused = focused;
+    if (lostFocus || now - gMetrics.lastWrite >= METRICS_FLUSH_S) MetricsWrite();
+}
+
+// Growable output buffer for the JSON text.
+typedef struct MetricsOut {
+    char  *buf;
+    size_t len, cap;
+    bool   failed;
+} MetricsOut;
+
+static void Out(MetricsOut *o, const char *fmt, ...)
+{
+    if (o->failed) return;
+    for (;;) {
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(o->buf + o->len, o->cap - o->len, fmt, ap);
+        va_end(ap);
+        if (n < 0) { o->failed = true; return; }
+        if ((size_t)n < o->cap - o->len) { o->len += (size_t)n; return; }
+        size_t cap = o->cap * 2 + (size_t)n;
+        char *nb = realloc(o->buf, cap);
+        if (!nb) { o->failed = true; return; }
+        o->buf = nb;
+        o->cap = cap;
+    }
+}
+
+static const char *MapName(int mapId)
+{
+    return (mapId >= 0 && mapId < MAP_COUNT) ? kMapNames[mapId] : "NONE";
+}
+
+// Summary plus the non-empty buckets as [lowMs, count] pairs.
+static void OutHist(MetricsOut *o, const FrameHist *h)
+{
+    Out(o, "\"frames\":%llu,\"meanMs\":%.3f,\"p50Ms\":%.3f,\"p90Ms\":%.3f,"
+           "\"p99Ms\":%.3f,\"maxMs\":%.3f,\"buckets\":[",
+        (unsigned long long)h->frames,
+        h->frames ? h->sumMs / (double)h->frames : 0.0,
+        HistQuantile(h, 0.50), HistQuantile(h, 0.90), HistQuantile(h, 0.99),
+        h->maxMs);
+    bool first = true;
+    for (int b = 0; b < METRICS_BUCKETS; b++) {
+        if (!h->count[b]) continue;
+        double width, low = BucketLow(b, &width);
+        Out(o, "%s[%.3f,%u]", first ? "" : ",", low / 1000.0, (unsigned)h->count[b]);
+        first = false;
+    }
+    Out(o, "]");
+}
+
+bool MetricsWrite(void)
+{
+    if (!gMetrics.started) return false;
+    MetricsOut o = { malloc(1 << 14), 0, 1 << 14, false };
+    if (!o.buf) return false;
+
+    Out(&o, "{\n\"sessionSeconds\":%.1f,\n\"hitchThresholdMs\":%.1f,\n\"screens\":[",
+        gMetrics.lastFrame - gMetrics.firstFrame, gMetrics.hitchMs);
+    bool first = true;
+    for (int s = 0; s < METRICS_SCREENS; s++) {
+        if (gMetrics.screens[s].frames == 0) continue;
+        Out(&o, "%s\n{\"screen\":\"%s\",", first ? "" : ",", kScreenNames[s]);
+        OutHist(&o, &gMetrics.screens[s]);
+        Out(&o, "}");
+        first = false;
+    }
+    Out(&o, "\n],\n\"maps\":[");
+    for (int i = 0; i < gMetrics.mapCount; i++) {
+        const MapHist *m = &gMetrics.maps[i];
+        Out(&o, "%s\n{\"map\":\"%s\",\"floor\":%d,", i ? "," : "", MapName(m->mapId), m->floor);
+        OutHist(&o, &m->h);
+        Out(&o, "}");
+    }
+    Out(&o, "\n],\n\"hitches\":[");
+    for (int i = 0; i < gMetrics.hitchCount; i++) {
+        const Hitch *h = &gMetrics.hitches[i];
+        const char *bs = (h->battleState >= 0 && h->battleState <= BS_FLEE)
+                         ? kBattleStateNames[h->battleState] : "NONE";
+        Out(&o, "%s\n{\"t\":%.2f,\"ms\":%.2f,\"screen\":\"%s\",\"map\":\"%s\","
+                "\"floor\":%d,\"battleState\":\"%s\"}",
+            i ? "," : "", h->t, h->ms, kScreenNames[h->screen], MapName(h->mapId),
+            h->floor, bs);
+    }
+    Out(&o, "\n],\n\"hitchesDropped\":%d\n}\n", gMetrics.hitchesDropped);
+
+    gMetrics.lastWrite = gMetrics.lastFrame;
+    bool ok = !o.failed && SaveFileData(SaveSiblingPath("session_metrics.json"),
+                                        o.buf, (int)o.len);
+    free(o.buf);
+    return ok;
+}
@@ -0,0 +1,31 @@
+#ifndef SESSION_METRICS_H
+#define SESSION_METRICS_H
+
+#include <stdbool.h>
+
+// Whole-session frame-time record for playtests on real devices: an
+// HDR-style histogram (log buckets, ~6% resolution from 1 us to ~17 s) per
+// GameScreen and per map/floor, plus a log of every frame over the hitch
+// threshold with what was going on at the time. MetricsWrite dumps it as
+// session_metrics.json beside savegame.dat, so a tester can send back
+// "p99 on HARBOR_PROC F5 is 41 ms" rather than "it felt laggy".
+
+#define METRICS_HITCH_MS_DEFAULT 50.0f
+
+// Attribution for the following frames. mapId / floor < 0 outside the
+// field; battleState < 0 when no battle is running.
+void MetricsSetField(int mapId, int floor, int battleState);
+
+// Records the time since the previous call against `screen` (a GameScreen).
+// Call once per frame, after EndDrawing.
+void MetricsFrameEnd(int screen);
+
+// Frames longer than this are logged individually. The DDKP_HITCH_MS
+// environment variable overrides the default at the first frame.
+void MetricsSetHitchThreshold(float ms);
+
+// Writes session_metrics.json. MetricsFrameEnd already rewrites it on focus
+// loss and every minute; call once more at session end.
+bool MetricsWrite(void);
+
+#endif // SESSION_METRICS_H
@@ -0,0 +1,197 @@
+#include "soak.h"
+#include "replay.h"
+#include "raylib.h"
+#include "../state/save.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    #include <unistd.h>
+#elif defined(__APPLE__)
+    #include <mach/mach.h>
+#endif
+
+typedef enum SoakMetric {
+    SOAK_RSS = 0,
+#ifdef RAYLIB_SHIM_H
+    SOAK_TEXTURES,
+    SOAK_TEXTURE_BYTES,
+    SOAK_FONTS,
+    SOAK_TEXT_ENTRIES,
+    SOAK_TEXT_BYTES,
+    SOAK_ATLASES,
+    SOAK_BATCH_BYTES,
+#endif
+    SOAK_METRIC_COUNT,
+} SoakMetric;
+
+// Growth below `floor` never fails, however large a share of a small
+// baseline it is: a few KB of RSS noise isn't a leak.
+typedef struct SoakMetricDef {
+    const char *name;
+    double      floor;
+} SoakMetricDef;
+
+static const SoakMetricDef kMetrics[SOAK_METRIC_COUNT] = {
+    [SOAK_RSS]           = { "rssBytes",         4.0 * 1024 * 1024 },
+#ifdef RAYLIB_SHIM_H
+    [SOAK_TEXTURES]      = { "liveTextures",     8.0 },
+    [SOAK_TEXTURE_BYTES] = { "liveTextureBytes", 4.0 * 1024 * 1024 },
+    [SOAK_FONTS]         = { "liveFonts",        0.5 },
+    [SOAK_TEXT_ENTRIES]  = { "textCacheEntries", 32.0 },
+    [SOAK_TEXT_BYTES]    = { "textCacheBytes",   1.0 * 1024 * 1024 },
+    [SOAK_ATLASES]       = { "glyphAtlases",     1.5 },
+    [SOAK_BATCH_BYTES]   = { "batchBytes",       256.0 * 1024 },
+#endif
+};
+
+typedef struct SoakSample {
+    int    minute;
+    double v[SOAK_METRIC_COUNT];
+} SoakSample;
+
+static struct {
+    bool        active;
+    float       minutes;
+    float       thresholdPct;
+    int         nextMinute;
+    SoakSample *samples;
+    int         count, cap;
+} gSoak;
+
+// Resident set size in bytes, or 0 where the platform won't say.
+static double ResidentBytes(void)
+{
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    long size = 0, pages = 0;      // statm: total then resident, in pages
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) return 0.0;
+    bool ok = fscanf(f, "%ld %ld", &size, &pages) == 2;
+    fclose(f);
+    return ok ? (double)pages * (double)sysconf(_SC_PAGESIZE) : 0.0;
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS)
+        return 0.0;
+    return (double)info.resident_size;
+#else
+    return 0.0;
+#endif
+}
+
+void SoakStart(float minutes, float thresholdPct)
+{
+    gSoak.active       = true;
+    gSoak.minutes      = minutes;
+    gSoak.thresholdPct = thresholdPct > 0.0f ? thresholdPct : SOAK_THRESHOLD_DEFAULT;
+}
+
+bool SoakActive(void)
+{
+    return gSoak.active;
+}
+
+static void TakeSample(int minute)
+{
+    if (gSoak.count == gSoak.cap) {
+        int cap = gSoak.cap ? gSoak.cap * 2 : 256;
+        SoakSample *ns = realloc(gSoak.samples, (size_t)cap * sizeof(SoakSample));
+        if (!ns) return;
+        gSoak.samples = ns;
+        gSoak.cap     = cap;
+    }
+    SoakSample *s = &gSoak.samples[gSoak.count++];
+    s->minute     = minute;
+    s->v[SOAK_RSS] = ResidentBytes();
+#ifdef RAYLIB_SHIM_H
+    ShimMemoryStats m = GetShimMemoryStats();
+    s->v[SOAK_TEXTURES]      = m.liveTextures;
+    s->v[SOAK_TEXTURE_BYTES] = (double)m.liveTextureBytes;
+    s->v[SOAK_FONTS]         = m.liveFonts;
+    s->v[SOAK_TEXT_ENTRIES]  = m.textCacheEntries;
+    s->v[SOAK_TEXT_BYTES]    = (double)m.textCacheBytes;
+    s->v[SOAK_ATLASES]       = m.glyphAtlases;
+    s->v[SOAK_BATCH_BYTES]   = (double)m.batchBytes;
+    printf("soak: minute %d rss %.1f MB, %d textures %.1f MB, text cache %d\n", minute,
+           s->v[SOAK_RSS] / 1048576.0, m.liveTextures, (double)m.liveTextureBytes / 1048576.0,
+           m.textCacheEntries);
+#else
+    printf("soak: minute %d rss %.1f MB\n", minute, s->v[SOAK_RSS] / 1048576.0);
+#endif
+}
+
+void SoakFrameEnd(void)
+{
+    if (!gSoak.active) return;
+    double simMinutes = ReplayTime() / 60.0;
+    while (gSoak.nextMinute <= (int)simMinutes) TakeSample(gSoak.nextMinute++);
+}
+
+bool SoakFinished(void)
+{
+    return gSoak.active && ReplayTime() >= (double)gSoak.minutes * 60.0;
+}
+
+// Least-squares slope of metric m per minute over samples [from, count).
+static double Slope(int m, int from)
+{
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (int i = from; i < gSoak.count; i++) {
+        double x = gSoak.samples[i].minute, y = gSoak.samples[i].v[m];
+        n++; sx += x; sy += y; sxx += x * x; sxy += x * y;
+    }
+    double den = n * sxx - sx * sx;
+    return den != 0.0 ? (n * sxy - sx * sy) / den : 0.0;
+}
+
+static void WriteCsv(void)
+{
+    size_t cap = 256 + (size_t)gSoak.count * (16 + SOAK_METRIC_COUNT * 24);
+    char *buf = malloc(cap);
+    if (!buf) return;
+    size_t len = (size_t)snprintf(buf, cap, "minute");
+    for (int m = 0; m < SOAK_METRIC_COUNT; m++)
+        len += (size_t)snprintf(buf + len, cap - len, ",%s", kMetrics[m].name);
+    len += (size_t)snprintf(buf + len, cap - len, "\n");
+    for (int i = 0; i < gSoak.count && len < cap; i++) {
+        len += (size_t)snprintf(buf + len, cap - len, "%d", gSoak.samples[i].minute);
+        for (int m = 0; m < SOAK_METRIC_COUNT; m++)
+            len += (size_t)snprintf(buf + len, cap - len, ",%.0f", gSoak.samples[i].v[m]);
+        len += (size_t)snprintf(buf + len, cap - len, "\n");
+    }
+    if (len < cap) SaveFileData(SaveSiblingPath("soak.csv"), buf, (int)len);
+    free(buf);
+}
+
+bool SoakReport(void)
+{
+    if (!gSoak.active) return true;
+    WriteCsv();
+
+    int from = 0;
+    while (from < gSoak.count && gSoak.samples[from].minute < SOAK_WARMUP_MINUTES) from++;
+    int judged = gSoak.count - from;
+    if (judged < 3) {
+        printf("soak: %d samples after warm-up, too few to judge\n", judged);
+        free(gSoak.samples);
+        gSoak.samples = NULL;
+        return true;
+    }
+
+    bool ok = true;
+    double span = gSoak.samples[gSoak.count - 1].minute - gSoak.samples[from].minute;
+    for (int m = 0; m < SOAK_METRIC_COUNT; m++) {
+        double base   = gSoak.samples[from].v[m];
+        double growth = Slope(m, from) * span;      // trend over the judged span
+        double pct    = base > 0.0 ? growth * 100.0 / base : (growth > 0.0 ? 100.0 : 0.0);
+        bool   leak   = growth > kMetrics[m].floor && pct > gSoak.thresholdPct;
+        printf("soak: %-18s %14.0f -> %+14.0f over %.0f min (%+.1f%%)%s\n", kMetrics[m].name,
+               base, growth, span, pct, leak ? "  GROWING" : "");
+        if (leak) ok = false;
+    }
+    printf("soak: %s (threshold %.1f%%)\n", ok ? "pass" : "FAIL", gSoak.thresholdPct);
+    free(gSoak.samples);
+    gSoak.samples = NULL;
+    return ok;
+}
@@ -0,0 +1,29 @@
+#ifndef SOAK_H
+#define SOAK_H
+
+#include <stdbool.h>
+
+// Soak runs: hours of unpaced play (a replay, or the random-input bot in
+// replay.h) watching for slow leaks the way a kiosk tablet would see them.
+// Once per simulated minute it samples process RSS and, on the SDL3 shim,
+// live texture count / bytes, fonts, the text cache and the glyph atlases
+// (GetShimMemoryStats). At the end each metric gets a least-squares trend
+// over the samples after warm-up; one that grew by more than the threshold
+// over the run fails it. Samples go to soak.csv beside savegame.dat.
+
+#define SOAK_WARMUP_MINUTES     5       // caches fill to their budgets here
+#define SOAK_THRESHOLD_DEFAULT  10.0f   // % growth over the run that fails
+
+// minutes: simulated length (ReplayTime). thresholdPct <= 0 uses the default.
+void SoakStart(float minutes, float thresholdPct);
+bool SoakActive(void);
+
+// Call once per frame, after EndDrawing.
+void SoakFrameEnd(void);
+bool SoakFinished(void);
+
+// Prints the trends and writes soak.csv. False when a metric grew past the
+// threshold. Call once at exit.
+bool SoakReport(void);
+
+#endif // SOAK_H
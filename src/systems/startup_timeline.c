@@ -0,0 +1,190 @@
+// clock_gettime is POSIX; strict -std=c99/c11 hides it without this.
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include "startup_timeline.h"
+#include "trace.h"
+#include "raylib.h"
+#include "../state/save.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    #include <unistd.h>
+#elif defined(__APPLE__)
+    #include <sys/sysctl.h>
+    #include <sys/time.h>
+    #include <unistd.h>
+#endif
+
+#define STARTUP_MAX_STAGES 32
+#define STARTUP_MAX_DEPTH  8
+
+typedef struct StartupStage {
+    const char *name;
+    int         depth;
+    uint64_t    beginNs, endNs;
+} StartupStage;
+
+static struct {
+    StartupStage stages[STARTUP_MAX_STAGES];
+    int          count;
+    int          open[STARTUP_MAX_DEPTH];   // stage index per nesting level
+    int          depth;
+    uint64_t     mainNs, finishNs;
+    double       preMainMs;                 // < 0 when the platform won't say
+    float        budgetMs;                  // 0 = none
+    bool         started, done;
+} gStartup = { .preMainMs = -1.0 };
+
+// Monotonic, so a clock adjustment mid-launch can't skew a stage. POSIX
+// clock_gettime rather than C11 timespec_get, which the Makefile's
+// -std=c99 hides; MSVC only has the latter.
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+#if defined(_MSC_VER)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Milliseconds between process creation and now, or -1.
+static double ProcessAgeMs(void)
+{
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    // Field 22 of /proc/self/stat is the start time in clock ticks since
+    // boot; /proc/uptime is seconds since boot.
+    double uptime = 0.0;
+    unsigned long long startTicks = 0;
+    FILE *f = fopen("/proc/uptime", "r");
+    if (!f) return -1.0;
+    bool ok = fscanf(f, "%lf", &uptime) == 1;
+    fclose(f);
+    f = fopen("/proc/self/stat", "r");
+    if (!f || !ok) { if (f) fclose(f); return -1.0; }
+    // The command name (field 2) can hold spaces; skip past its ')'.
+    int c;
+    while ((c = fgetc(f)) != EOF && c != ')') {}
+    ok = fscanf(f, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u %*d %*d %*d %*d %*d %*d %llu",
+                &startTicks) == 1;
+    fclose(f);
+    long hz = sysconf(_SC_CLK_TCK);
+    if (!ok || hz <= 0) return -1.0;
+    double ms = (uptime - (double)startTicks / (double)hz) * 1000.0;
+    return ms > 0.0 ? ms : 0.0;     // tick rounding can undershoot
+#elif defined(__APPLE__)
+    struct kinfo_proc info;
+    size_t size = sizeof(info);
+    int mib[4] = { CTL_KERN, KERN_PROC, KERN_PROC_PID, getpid() };
+    if (sysctl(mib, 4, &info, &size, NULL, 0) != 0) return -1.0;
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    const struct timeval *st = &info.kp_proc.p_starttime;
+    return (double)(now.tv_sec - st->tv_sec) * 1000.0 +
+           (double)(now.tv_usec - st->tv_usec) / 1000.0;
+#else
+    return -1.0;
+#endif
+}
+
+void StartupInit(void)
+{
+    if (gStartup.started) return;
+    gStartup.started   = true;
+    gStartup.mainNs    = NowNs();
+    gStartup.preMainMs = ProcessAgeMs();
+    const char *env = getenv("DDKP_STARTUP_BUDGET_MS");
+    if (env && atof(env) > 0.0) gStartup.budgetMs = (float)atof(env);
+}
+
+void StartupSetBudget(float ms)
+{
+    gStartup.budgetMs = ms;
+}
+
+void StartupBegin(const char *stage)
+{
+    if (gStartup.done) return;
+    TraceBegin(stage);
+    if (gStartup.depth >= STARTUP_MAX_DEPTH) { gStartup.depth++; return; }
+    int idx = -1;
+    if (gStartup.count < STARTUP_MAX_STAGES) {
+        idx = gStartup.count++;
+        gStartup.stages[idx] = (StartupStage){ stage, gStartup.depth, NowNs(), 0 };
+    }
+    gStartup.open[gStartup.depth++] = idx;
+}
+
+void StartupEnd(void)
+{
+    if (gStartup.done || gStartup.depth == 0) return;
+    TraceEnd();
+    if (--gStartup.depth >= STARTUP_MAX_DEPTH) return;
+    int idx = gStartup.open[gStartup.depth];
+    if (idx >= 0) gStartup.stages[idx].endNs = NowNs();
+}
+
+bool StartupDone(void)
+{
+    return gStartup.done;
+}
+
+static double Ms(uint64_t a, uint64_t b)
+{
+    return (double)(b - a) / 1.0e6;
+}
+
+static double TotalMs(void)
+{
+    return Ms(gStartup.mainNs, gStartup.finishNs);
+}
+
+bool StartupWithinBudget(void)
+{
+    return !gStartup.done || gStartup.budgetMs <= 0.0f || TotalMs() <= gStartup.budgetMs;
+}
+
+void StartupFinish(void)
+{
+    if (gStartup.done) return;
+    while (gStartup.depth > 0) StartupEnd();
+    gStartup.finishNs = NowNs();
+    gStartup.done     = true;
+
+    double total = TotalMs();
+    if (gStartup.preMainMs >= 0.0)
+        printf("startup: %.1f ms before main (platform)\n", gStartup.preMainMs);
+    for (int i = 0; i < gStartup.count; i++) {
+        const StartupStage *s = &gStartup.stages[i];
+        printf("startup: %*s%-*s %8.1f ms  (at %.1f)\n", s->depth * 2, "",
+               28 - s->depth * 2, s->name, Ms(s->beginNs, s->endNs),
+               Ms(gStartup.mainNs, s->beginNs));
+    }
+    printf("startup: main to first present %.1f ms", total);
+    if (gStartup.budgetMs > 0.0f)
+        printf(", budget %.0f ms: %s", gStartup.budgetMs, StartupWithinBudget() ? "ok" : "OVER");
+    printf("\n");
+
+    char json[4096];
+    int len = snprintf(json, sizeof(json),
+                       "{\n\"preMainMs\":%.1f,\n\"mainToFirstPresentMs\":%.1f,\n"
+                       "\"budgetMs\":%.1f,\n\"stages\":[",
+                       gStartup.preMainMs, total, gStartup.budgetMs);
+    for (int i = 0; i < gStartup.count && len < (int)sizeof(json); i++) {
+        const StartupStage *s = &gStartup.stages[i];
+        len += snprintf(json + len, sizeof(json) - (size_t)len,
+                        "%s\n{\"name\":\"%s\",\"depth\":%d,\"atMs\":%.2f,\"ms\":%.2f}",
+                        i ? "," : "", s->name, s->depth, Ms(gStartup.mainNs, s->beginNs),
+                        Ms(s->beginNs, s->endNs));
+    }
+    if (len < (int)sizeof(json))
+        len += snprintf(json + len, sizeof(json) - (size_t)len, "\n]\n}\n");
+    if (len < (int)sizeof(json))
+        SaveFileData(SaveSiblingPath("startup_timeline.json"), json, len);
+}
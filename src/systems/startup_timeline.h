@@ -0,0 +1,36 @@
+#ifndef STARTUP_TIMELINE_H
+#define STARTUP_TIMELINE_H
+
+#include <stdbool.h>
+
+// Cold-start timeline, from main() to the first presented frame. Each stage
+// (InitWindow with SDL_Init / TTF_Init inside it on the SDL3 build,
+// LoadFontEx, PHInit's grain bake, the title texture decode, the first
+// present) is timed on its own, and the time the OS spent before main()
+// is read back where the platform exposes it (Linux/Android: /proc, 10 ms
+// resolution; Apple: the kernel's process start time). So a slow launch
+// splits into "ours" and "the platform's".
+//
+// StartupFinish prints the timeline and writes startup_timeline.json beside
+// savegame.dat (phones have no console). With a budget set, it also says
+// whether main-to-first-present made it; a headless one-frame run with
+// --startup-budget is the startup benchmark.
+
+// Call first thing in main. DDKP_STARTUP_BUDGET_MS=<ms> sets a budget.
+void StartupInit(void);
+void StartupSetBudget(float ms);
+
+// Stages nest. Also recorded as trace zones (systems/trace.h). The pair
+// matches SetRenderTraceHooks, so the SDL3 shim can time its own stages.
+// No-ops once the timeline is finished.
+void StartupBegin(const char *stage);
+void StartupEnd(void);
+
+// Closes the timeline at the first interactive frame and reports it.
+void StartupFinish(void);
+bool StartupDone(void);
+
+// False only when a budget was set and main-to-first-present exceeded it.
+bool StartupWithinBudget(void);
+
+#endif // STARTUP_TIMELINE_H
@@ -1,4 +1,5 @@
 #include "touch_input.h"
+#include "replay.h"
 #include <math.h>
 
 #define DEADZONE_PX      14.0f
@@ -29,13 +30,6 @@ static struct {
     int     pressedDir;
 } g;
 
-static bool GetPrimaryPoint(Vector2 *out)
-{
-    if (GetTouchPointCount() > 0) { *out = GetTouchPosition(0); return true; }
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) { *out = GetMousePosition(); return true; }
-    return false;
-}
-
 void TouchInputUpdate(void)
 {
     g.tapReady        = false;
@@ -43,8 +37,10 @@ void TouchInputUpdate(void)
     g.frameDx         = 0.0f;
     g.frameDy         = 0.0f;
 
+    // Pointer and clock come from the replay layer so recorded gestures
+    // resolve to the same taps and swipes on playback.
     Vector2 p;
-    bool down = GetPrimaryPoint(&p);
+    bool down = ReplayPointer(&p);
 
     if (down && !g.active) {
         g.active          = true;
@@ -52,7 +48,7 @@ void TouchInputUpdate(void)
         g.gestureStart    = p;
         g.curPos          = p;
         g.prevPos         = p;
-        g.startTime       = GetTime();
+        g.startTime       = ReplayTime();
         g.totalDist       = 0.0f;
         g.lockedDir       = -1;
         g.directionLocked = false;
@@ -102,7 +98,7 @@ void TouchInputUpdate(void)
     }
 
     if (!down && g.active) {
-        double dur = GetTime() - g.startTime;
+        double dur = ReplayTime() - g.startTime;
         // Consumed gestures still emit the terminal tap — consume blocks the
         // direction stream (so swipes don't leak into field walk) but the tap
         // is what actually reports "the finger went up on this button."
@@ -198,7 +194,7 @@ bool TouchHeldInRect(Rectangle r, float secs)
 {
     if (!g.active) return false;
     if (g.totalDist > TAP_MAX_DIST_PX) return false;
-    if (GetTime() - g.startTime < (double)secs) return false;
+    if (ReplayTime() - g.startTime < (double)secs) return false;
     Vector2 p = g.curPos;
     return (p.x >= r.x && p.x < r.x + r.width &&
             p.y >= r.y && p.y < r.y + r.height);
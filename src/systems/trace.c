@@ -0,0 +1,195 @@
+// clock_gettime is POSIX; strict -std=c99/c11 hides it without this.
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include "trace.h"
+#include "raylib.h"
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Each thread writes only its own ring, so recording needs no lock: the
+// writer fills a slot and then publishes it by bumping `head` with release
+// order; TraceWrite reads `head` with acquire order and copies the slots
+// behind it. A writer lapping the reader mid-copy can tear the oldest few
+// events of that thread, which is fine for a diagnostic dump.
+//
+// Threads register on their first zone by claiming an index with an atomic
+// add. Past TRACE_MAX_THREADS a thread simply isn't recorded.
+#define TRACE_RING         65536   // zones per thread, power of two
+#define TRACE_MAX_THREADS  8
+#define TRACE_MAX_DEPTH    32
+#define TRACE_DEFAULT_PATH "trace.json"
+
+typedef struct TraceEvent {
+    const char *name;
+    uint64_t    startNs;
+    uint64_t    durNs;
+} TraceEvent;
+
+typedef struct TraceBuffer {
+    TraceEvent       ev[TRACE_RING];
+    _Atomic uint64_t head;          // zones ever written; slot = head % RING
+    // Open zones. Only the owning thread touches these.
+    const char      *openName[TRACE_MAX_DEPTH];
+    uint64_t         openNs[TRACE_MAX_DEPTH];
+    int              depth;
+    int              tid;
+} TraceBuffer;
+
+static TraceBuffer *_Atomic gTraceThreads[TRACE_MAX_THREADS];
+static atomic_int           gTraceThreadCount;
+static atomic_bool          gTraceOn;
+static uint64_t             gTraceEpochNs;
+static char                 gTracePath[256] = TRACE_DEFAULT_PATH;
+
+static _Thread_local TraceBuffer *tTrace;
+static _Thread_local bool         tTraceRefused;   // out of thread slots
+
+// Wall clock, like the TIME_UTC it replaces. clock_gettime is POSIX, which
+// the Makefile's -std=c99 -D_DEFAULT_SOURCE exposes; C11's timespec_get is
+// hidden there. MSVC has no clock_gettime, but its CRT has timespec_get.
+static uint64_t TraceNowNs(void)
+{
+    struct timespec ts;
+#if defined(_MSC_VER)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static TraceBuffer *TraceThreadBuffer(void)
+{
+    if (tTrace || tTraceRefused) return tTrace;
+    int idx = atomic_fetch_add(&gTraceThreadCount, 1);
+    TraceBuffer *b = idx < TRACE_MAX_THREADS ? calloc(1, sizeof(TraceBuffer)) : NULL;
+    if (!b) {
+        tTraceRefused = true;
+        return NULL;
+    }
+    b->tid = idx + 1;
+    atomic_store_explicit(&gTraceThreads[idx], b, memory_order_release);
+    tTrace = b;
+    return b;
+}
+
+void TraceInit(void)
+{
+    const char *env = getenv("DDKP_TRACE");
+    if (env && env[0] != '\0') TraceStart(strcmp(env, "1") == 0 ? NULL : env);
+}
+
+void TraceStart(const char *path)
+{
+    snprintf(gTracePath, sizeof(gTracePath), "%s", path ? path : TRACE_DEFAULT_PATH);
+    if (gTraceEpochNs == 0) gTraceEpochNs = TraceNowNs();
+    TraceThreadBuffer();   // the starting (main) thread gets tid 1
+    atomic_store(&gTraceOn, true);
+}
+
+bool TraceEnabled(void)
+{
+    return atomic_load_explicit(&gTraceOn, memory_order_relaxed);
+}
+
+void TraceBegin(const char *name)
+{
+    if (!atomic_load_explicit(&gTraceOn, memory_order_relaxed)) return;
+    TraceBuffer *b = TraceThreadBuffer();
+    if (!b) return;
+    // Past the depth cap the zone is dropped, but still counted so the
+    // matching TraceEnd pops the right level.
+    if (b->depth < TRACE_MAX_DEPTH) {
+        b->openName[b->depth] = name;
+        b->openNs[b->depth]   = TraceNowNs();
+    }
+    b->depth++;
+}
+
+void TraceEnd(void)
+{
+    TraceBuffer *b = tTrace;
+    if (!b || b->depth == 0) return;
+    b->depth--;
+    if (b->depth >= TRACE_MAX_DEPTH) return;
+
+    uint64_t h = atomic_load_explicit(&b->head, memory_order_relaxed);
+    TraceEvent *e = &b->ev[h & (TRACE_RING - 1)];
+    e->name    = b->openName[b->depth];
+    e->startNs = b->openNs[b->depth];
+    e->durNs   = TraceNowNs() - e->startNs;
+    atomic_store_explicit(&b->head, h + 1, memory_order_release);
+}
+
+// Growable output buffer for the JSON text.
+typedef struct TraceOut {
+    char  *buf;
+    size_t len, cap;
+    bool   failed;
+} TraceOut;
+
+static void TraceAppend(TraceOut *o, const char *fmt, ...)
+{
+    if (o->failed) return;
+    for (;;) {
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(o->buf + o->len, o->cap - o->len, fmt, ap);
+        va_end(ap);
+        if (n < 0) { o->failed = true; return; }
+        if ((size_t)n < o->cap - o->len) { o->len += (size_t)n; return; }
+        size_t cap = o->cap * 2 + (size_t)n;
+        char *nb = realloc(o->buf, cap);
+        if (!nb) { o->failed = true; return; }
+        o->buf = nb;
+        o->cap = cap;
+    }
+}
+
+bool TraceWrite(void)
+{
+    TraceOut o = { malloc(1 << 16), 0, 1 << 16, false };
+    if (!o.buf) return false;
+
+    TraceAppend(&o, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    TraceAppend(&o, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                    "\"args\":{\"name\":\"ddkp\"}}");
+    int threads = atomic_load(&gTraceThreadCount);
+    if (threads > TRACE_MAX_THREADS) threads = TRACE_MAX_THREADS;
+    for (int t = 0; t < threads; t++) {
+        TraceBuffer *b = atomic_load_explicit(&gTraceThreads[t], memory_order_acquire);
+        if (!b) continue;
+        TraceAppend(&o, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                        "\"args\":{\"name\":\"%s\"}}",
+                    b->tid, b->tid == 1 ? "main" : "worker");
+        uint64_t h = atomic_load_explicit(&b->head, memory_order_acquire);
+        uint64_t first = h > TRACE_RING ? h - TRACE_RING : 0;
+        for (uint64_t i = first; i < h; i++) {
+            const TraceEvent *e = &b->ev[i & (TRACE_RING - 1)];
+            // Timestamps in microseconds, relative to TraceStart.
+            TraceAppend(&o, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                            "\"ts\":%.3f,\"dur\":%.3f}",
+                        e->name, b->tid,
+                        (double)(e->startNs - gTraceEpochNs) / 1000.0,
+                        (double)e->durNs / 1000.0);
+        }
+    }
+    TraceAppend(&o, "\n]}\n");
+
+    bool ok = !o.failed && SaveFileData(gTracePath, o.buf, (int)o.len);
+    free(o.buf);
+    return ok;
+}
+
+void TraceShutdown(void)
+{
+    if (TraceEnabled()) TraceWrite();
+    atomic_store(&gTraceOn, false);
+}
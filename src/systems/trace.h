@@ -0,0 +1,31 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+
+// Timeline capture in Chrome trace-event JSON, for loading into
+// ui.perfetto.dev (or chrome://tracing) to see where a hitch went. Zones
+// are recorded as complete ("X") events into a per-thread ring, so only the
+// newest TRACE_RING zones per thread survive a long session; that is the
+// window around the hitch you just saw, which is what we want.
+//
+// Recording is off until TraceStart, or until TraceInit finds DDKP_TRACE in
+// the environment (its value is the output path; "1" means the default
+// trace.json). While off, TraceBegin / TraceEnd are a load and a branch.
+//
+// Zone names are stored by pointer: pass string literals.
+
+void TraceInit(void);
+void TraceStart(const char *path);   // NULL = trace.json
+bool TraceEnabled(void);
+
+void TraceBegin(const char *name);
+void TraceEnd(void);                 // closes the innermost open zone
+
+// Writes everything currently in the rings; recording continues.
+bool TraceWrite(void);
+
+// Writes the trace if recording. Call once at exit.
+void TraceShutdown(void);
+
+#endif // TRACE_H
@@ -3,15 +3,20 @@
 #include "../render/paper_harbor.h"
 #include "../screen_layout.h"
 
+// Primary pointer down inside r, as the replay layer reports it.
+static bool PointerHeldIn(Rectangle r)
+{
+    Vector2 p;
+    return ReplayPointer(&p) && CheckCollisionPointRec(p, r);
+}
+
 bool DrawChunkyButton(Rectangle r, const char *label, int fontSize,
                       bool primary, bool enabled)
 {
     // "Held" — finger/cursor is currently inside the rect AND the primary
     // pointer is down. Used purely for the visual sink; the actual tap
     // semantics are handled by TouchTapInRect below.
-    bool held = enabled &&
-                CheckCollisionPointRec(GetMousePosition(), r) &&
-                IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+    bool held = enabled && PointerHeldIn(r);
 
     Color plateBase = primary ? gPH.roof  : gPH.panel;
     Color border    = enabled ? gPH.ink   : gPH.inkLight;
@@ -43,8 +48,7 @@ bool DrawBackIconButton(Rectangle r)
     // screen. This now reads as "another chunky button, but with a chevron
     // glyph instead of a label," which is what every other button looks
     // like.
-    bool held = CheckCollisionPointRec(GetMousePosition(), r) &&
-                IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+    bool held = PointerHeldIn(r);
 
     if (!held) {
         DrawRectangleRounded((Rectangle){r.x + 2, r.y + 3, r.width, r.height},